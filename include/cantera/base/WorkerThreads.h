@@ -0,0 +1,98 @@
+/**
+ *  @file WorkerThreads.h
+ */
+
+#ifndef CT_WORKERTHREADS_H
+#define CT_WORKERTHREADS_H
+
+#include "ct_defs.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace Cantera
+{
+
+//! A fixed set of threads which are reused to run groups of tasks
+/*!
+ * The background threads are created by the constructor and wait until they
+ * are given a task by run(), so the cost of creating the threads is only
+ * incurred once, rather than each time a group of tasks is run. The calling
+ * thread runs the first task of each group itself.
+ *
+ * The member functions of this class must only be called from one thread at
+ * a time.
+ */
+class WorkerThreads
+{
+public:
+    //! Constructor
+    /*!
+     * @param nThreads  Maximum number of tasks which are run concurrently,
+     *                  including the one run by the calling thread. One less
+     *                  background thread is created.
+     */
+    explicit WorkerThreads(size_t nThreads);
+    ~WorkerThreads();
+
+    WorkerThreads(const WorkerThreads&) = delete;
+    WorkerThreads& operator=(const WorkerThreads&) = delete;
+
+    //! Number of tasks which can be run concurrently
+    size_t nThreads() const {
+        return m_threads.size() + 1;
+    }
+
+    //! Run the tasks `task(0)` to `task(n-1)` concurrently, and wait until
+    //! all of them have finished
+    /*!
+     * Task 0 is run by the calling thread, and task *i* by background thread
+     * *i*-1. If any of the tasks throws an exception, it is rethrown after
+     * all tasks have finished.
+     *
+     * @param n     Number of tasks. Must not be larger than nThreads().
+     * @param task  Function called with the index of the task
+     */
+    void run(size_t n, const std::function<void(size_t)>& task);
+
+private:
+    //! The loop executed by background thread *i*-1, which runs task *i*
+    void work(size_t i);
+
+    std::vector<std::thread> m_threads;
+
+    //! Protects all of the following members
+    std::mutex m_mutex;
+
+    //! Signals the background threads that a new group of tasks is available
+    //! or that they should stop
+    std::condition_variable m_start;
+
+    //! Signals the calling thread that all background tasks have finished
+    std::condition_variable m_done;
+
+    //! The current task function
+    const std::function<void(size_t)>* m_task;
+
+    //! Number of tasks in the current group
+    size_t m_nTasks;
+
+    //! Incremented for each group of tasks
+    size_t m_generation;
+
+    //! Number of background tasks in the current group which have not
+    //! finished yet
+    size_t m_pending;
+
+    //! Set by the destructor to stop the background threads
+    bool m_stop;
+
+    //! Exceptions thrown by each task of the current group
+    std::vector<std::exception_ptr> m_errors;
+};
+
+}
+
+#endif
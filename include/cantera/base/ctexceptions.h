@@ -271,8 +271,17 @@ public:
 #endif
 
 //! Throw an exception if the specified exception is not a finite number.
+/*!
+ * Like the other Assert* checks, this check is skipped if NDEBUG is defined.
+ * It is also skipped if %Cantera is configured with finite_checks=no, which
+ * defines CT_NO_FINITE_CHECKS.
+ */
 #ifndef AssertFinite
-#  define AssertFinite(expr, procedure, ...) AssertThrowMsg(expr < BigNumber && expr > -BigNumber, procedure, __VA_ARGS__)
+#  ifdef CT_NO_FINITE_CHECKS
+#    define AssertFinite(expr, procedure, ...) ((void) (0))
+#  else
+#    define AssertFinite(expr, procedure, ...) AssertThrowMsg(expr < BigNumber && expr > -BigNumber, procedure, __VA_ARGS__)
+#  endif
 #endif
 
 }
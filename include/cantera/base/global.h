@@ -160,6 +160,28 @@ inline void debuglog(const std::string& msg, int loglevel)
     }
 }
 
+//! Write a message to the log only if loglevel > 0. Avoids constructing a
+//! string when called with a string literal and logging is disabled.
+inline void debuglog(const char* msg, int loglevel)
+{
+    if (loglevel > 0) {
+        writelog_direct(msg);
+    }
+}
+
+//! Write a formatted message to the log only if loglevel > 0.
+//!
+//! The arguments are the same as for writelog(), but the message is only
+//! formatted if it is going to be written, so this function can be used in
+//! performance-sensitive code.
+//! @ingroup textlogs
+template <typename... Args>
+void debuglog(int loglevel, const char* fmt, const Args&... args) {
+    if (loglevel > 0) {
+        writelog_direct(fmt::format(fmt, args...));
+    }
+}
+
 //! Write a formatted message to the screen.
 //!
 //! This function passes its arguments to the fmt library 'format' function to
@@ -519,7 +519,64 @@ void checkFinite(const double tmp);
  * @param values  Array of *N* values to be checked
  * @param N       Number of elements in *values*
  */
-void checkFinite(const std::string& name, double* values, size_t N);
+void checkFinite(const std::string& name, const double* values, size_t N);
+
+//! @name Configurable checks for non-finite values
+//!
+//! The CheckFiniteSampled() macro checks that all elements of an array are
+//! finite in performance-sensitive code, such as the right hand side of the
+//! equations integrated by ReactorNet. These checks are removed at compile
+//! time if %Cantera is configured with finite_checks=no, which defines
+//! CT_NO_FINITE_CHECKS. Otherwise, they can be disabled or sampled at run time
+//! with setFiniteCheckInterval(), and non-finite values can be counted instead
+//! of raising an exception with setFiniteCheckThrows().
+//@{
+
+//! Set how often the checks made with CheckFiniteSampled() are performed. If
+//! *n* is 0, the checks are disabled. Otherwise, every *n*-th check at each
+//! location is performed, counted separately for each thread. Defaults to 1.
+void setFiniteCheckInterval(size_t n);
+
+//! The interval set by setFiniteCheckInterval()
+size_t finiteCheckInterval();
+
+//! Set whether non-finite values found by CheckFiniteSampled() raise an
+//! exception (the default), or are only counted (see nonFiniteCount()).
+void setFiniteCheckThrows(bool throws);
+
+//! The number of checks made with CheckFiniteSampled() in all threads which
+//! found non-finite values, since the last call to resetNonFiniteCount().
+size_t nonFiniteCount();
+
+//! Reset the count returned by nonFiniteCount() to zero
+void resetNonFiniteCount();
+
+//! Increment the number of checks at a location made by the current thread,
+//! given by *count*, and return true if this check should be performed.
+//! Used by CheckFiniteSampled().
+bool finiteCheckDue(unsigned long& count);
+
+//! Check that all elements of *values* are finite, counting the arrays that
+//! are not and raising an exception if setFiniteCheckThrows() is enabled.
+//! Used by CheckFiniteSampled().
+void checkFiniteCounted(const char* name, const double* values, size_t N);
+
+//@}
+
+//! Check that all elements of the array *values* of length *N* are finite,
+//! subject to the options set by setFiniteCheckInterval() and
+//! setFiniteCheckThrows(). *name* is used in the error message.
+#ifdef CT_NO_FINITE_CHECKS
+#  define CheckFiniteSampled(name, values, N) ((void) (0))
+#else
+#  define CheckFiniteSampled(name, values, N) \
+    do { \
+        static thread_local unsigned long ct_finite_check_count = 0; \
+        if (Cantera::finiteCheckDue(ct_finite_check_count)) { \
+            Cantera::checkFiniteCounted(name, values, N); \
+        } \
+    } while (0)
+#endif
 
 //! Const accessor for a value in a std::map.
 /*!
@@ -27,19 +27,28 @@ class XML_Reader
 public:
     //! Sole Constructor for the XML_Reader class
     /*!
+     * The entire contents of the input stream are read into memory when the
+     * reader is constructed, and the tags and values are then located by
+     * scanning this buffer.
+     *
      *  @param input   Reference to the istream object containing the XML file
      */
     XML_Reader(std::istream& input);
 
-    //! Read a single character from the input stream and returns it
+    //! Read a single character from the input buffer and returns it
     /*!
-     * All low level reads occur through this function. The function also keeps
-     * track of the line numbers.
+     * The function also keeps track of the line numbers. If the end of the
+     * input has been reached, *ch* is not modified.
      *
      * @param ch   Character to be returned.
      */
     void getchr(char& ch);
 
+    //! True if all of the input has been read
+    bool eof() const {
+        return m_pos >= m_buf.size();
+    }
+
     //!  Searches a string for the first occurrence of a valid quoted string.
     /*!
      * Quotes can start with either a single quote or a double quote, but must
@@ -65,7 +74,7 @@ public:
 
     //! Reads an XML tag into a string
     /*!
-     * This function advances the input streams pointer
+     * This function advances the position in the input buffer
      *
      * @param attribs   map of attribute name and attribute value - output
      * @return          Output string containing name of the XML
@@ -74,13 +83,20 @@ public:
 
     //! Return the value portion of an XML element
     /*!
-     * This function advances the input streams pointer
+     * This function advances the position in the input buffer
      */
     std::string readValue();
 
 protected:
-    //! Input stream containing the XML file
-    std::istream& m_s;
+    //! Advance the position in the input buffer to *pos*, counting the lines
+    //! which are skipped
+    void advance(size_t pos);
+
+    //! Contents of the XML file
+    std::string m_buf;
+
+    //! Position of the next character to be read from #m_buf
+    size_t m_pos;
 
 public:
     //! Line count
@@ -91,6 +107,11 @@ public:
 /*!
  * There are routines for adding to the tree, querying and searching the tree,
  * and for writing the tree out to an output file.
+ *
+ * The recursive searches findID(), findByAttr(), findNameID() and
+ * findByName() use lookup tables owned by the root of the tree, which are
+ * created by the first search and discarded whenever the tree is modified.
+ * The results are the same as those of a search through the tree.
  */
 class XML_Node
 {
@@ -184,8 +205,8 @@ public:
     /*!
      * This function removes an XML_Node from the children of this node.
      *
-     * @param  node  Pointer to the node to be removed. Note, this node
-     *               isn't modified in any way.
+     * @param  node  Pointer to the node to be removed. The node is not
+     *               deleted, and becomes the root of a separate tree.
      */
     void removeChild(const XML_Node* const node);
 
@@ -375,6 +396,7 @@ public:
      */
     void setName(const std::string& name_) {
         m_name = name_;
+        invalidateIndex();
     }
 
     //! Return the id attribute, if present
@@ -623,6 +645,21 @@ private:
      */
     void write_int(std::ostream& s, int level = 0, int numRecursivesAllowed = 60000) const;
 
+    //! Lookup tables used for searching the tree
+    struct Index;
+
+    //! Return the lookup tables for the tree containing this node, creating
+    //! them if necessary. Returns null if this node is not part of the tree
+    //! described by its root. The caller must hold the lock on the tables.
+    Index* index() const;
+
+    //! Discard the lookup tables of the tree containing this node. Takes the
+    //! lock on the tables, so that searches of other nodes in the tree from
+    //! other threads do not use tables which are being deleted. The contents
+    //! of the tree itself must still not be modified while it is being
+    //! searched by another thread.
+    void invalidateIndex();
+
 protected:
     //! XML node name of the node.
     /*!
@@ -698,6 +735,17 @@ protected:
      *  Currently, unimplemented functionality
      */
     int m_linenum;
+
+    //! Lookup tables for searching the tree. Only used by the root node.
+    mutable std::unique_ptr<Index> m_index;
+
+    //! Position of this node in a depth-first traversal of the tree, and the
+    //! position following the last node of its subtree. Set when the lookup
+    //! tables are created.
+    mutable size_t m_order, m_end;
+
+    //! Depth of this node in the tree. Set when the lookup tables are created.
+    mutable int m_depth;
 };
 
 //! Search an XML_Node tree for a named phase XML_Node
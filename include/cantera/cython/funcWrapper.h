@@ -9,6 +9,19 @@
 
 typedef double(*callback_wrapper)(double, void*, void**);
 
+// Holds the GIL for the lifetime of the object. Used by functions which may
+// be called from C++ code that was invoked with the GIL released.
+class PythonGIL
+{
+public:
+    PythonGIL() : m_state(PyGILState_Ensure()) {}
+    ~PythonGIL() {
+        PyGILState_Release(m_state);
+    }
+private:
+    PyGILState_STATE m_state;
+};
+
 // A C++ exception that holds a Python exception so that it can be re-raised
 // by translate_exception()
 class CallbackError : public Cantera::CanteraError
@@ -20,6 +33,7 @@ public:
     {
     }
     const char* what() const throw() {
+        PythonGIL gil;
         formattedMessage_ = "\n" + std::string(71, '*') + "\n";
         formattedMessage_ += "Exception raised in Python callback function:\n";
 
@@ -3,6 +3,7 @@
 #include "cantera/transport/TransportBase.h"
 #include "cantera/kinetics/Kinetics.h"
 
+#include "cantera/cython/funcWrapper.h"
 #include "Python.h"
 
 // Wrappers for preprocessor defines
@@ -20,6 +21,7 @@ class PythonLogger : public Cantera::Logger
 {
 public:
     virtual void write(const std::string& s) {
+        PythonGIL gil;
         // 1000 bytes is the maximum size permitted by PySys_WriteStdout
         static const size_t N = 999;
         for (size_t i = 0; i < s.size(); i+=N) {
@@ -29,11 +31,13 @@ public:
     }
 
     virtual void writeendl() {
+        PythonGIL gil;
         PySys_WriteStdout("%s", "\n");
         std::cout.flush();
     }
 
     virtual void error(const std::string& msg) {
+        PythonGIL gil;
         std::string err = "raise Exception('''"+msg+"''')";
         PyRun_SimpleString(err.c_str());
     }
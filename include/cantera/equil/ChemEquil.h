@@ -282,6 +282,7 @@ protected:
     vector_fp m_reswork;
     vector_fp m_jwork1;
     vector_fp m_jwork2;
+    vector_fp m_actCoeff; //!< Work array of activity coefficients
 
     //! Storage of the element compositions. natom(k,m) = m_comp[k*m_mm+ m];
     vector_fp m_comp;
@@ -0,0 +1,232 @@
+/**
+ *  @file EquilibriumTable.h
+ *  Tabulation of the equilibrium states of mixtures of two streams (see
+ *  \ref equilfunctions and class
+ *  \link Cantera::EquilibriumTable EquilibriumTable\endlink).
+ */
+
+#ifndef CT_EQUILIBRIUMTABLE_H
+#define CT_EQUILIBRIUMTABLE_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class ThermoPhase;
+
+//! An adaptive table of the equilibrium states of a phase, at constant
+//! enthalpy and pressure, for mixtures of a fuel and an oxidizer stream
+/*!
+ * The table is a function of the mixture fraction \f$ Z \f$ (the mass fraction
+ * of the mixture which originates from the fuel stream), the specific enthalpy
+ * \f$ h \f$ [J/kg] and the pressure \f$ P \f$ [Pa], and returns the equilibrium
+ * temperature and mass fractions. At each mixture fraction, the enthalpy range
+ * of the table is that of the unreacted mixture between the temperatures
+ * given to setTemperatureRange(), and the enthalpy is represented by its
+ * normalized position within this range. The pressure coordinate is
+ * \f$ \ln P \f$. If the minimum and maximum pressures are the same, the table
+ * is two-dimensional.
+ *
+ * The table is built by starting from a uniform grid of cells, and then
+ * refining each cell by bisecting it in every direction, as long as the
+ * difference between the multilinear interpolation of the corner values and
+ * the equilibrium state at the center of the cell or of any of its faces or
+ * edges exceeds the tolerances given to setTolerances(). Refinement stops
+ * after the number of levels given to setGrid(), so the initial grid must be
+ * fine enough to resolve the sharpest variations of the equilibrium state,
+ * e.g. near the stoichiometric mixture fraction. The equilibrium
+ * states at each level of refinement are computed in parallel, each thread
+ * using its own copy of the phase, created from the phase's XML definition.
+ * Mass fractions are interpolated rather than mole fractions, so that the
+ * element mass fractions of the interpolated composition vary linearly with
+ * the mixture fraction, as they do for the exact composition.
+ *
+ * Adjacent cells may have different levels of refinement, in which case the
+ * interpolated state is not continuous across their common face. The
+ * interpolation error is only checked in cells which can still be refined,
+ * so it may exceed the tolerances in the cells at the maximum level of
+ * refinement. nFinestCells() gives the number of these cells.
+ *
+ * Lookups do not modify the table, and may be made concurrently from multiple
+ * threads. The table can be saved to a file and loaded again later, without
+ * recomputing any equilibrium states.
+ *
+ * @ingroup equilfunctions
+ */
+class EquilibriumTable
+{
+public:
+    //! Constructor
+    /*!
+     * @param phase     Phase to be equilibrated. To build a table, the phase
+     *                  must have been created from an input file.
+     * @param nThreads  Number of threads used to build the table. If zero,
+     *                  the number of hardware threads is used.
+     */
+    EquilibriumTable(ThermoPhase& phase, size_t nThreads=0);
+    ~EquilibriumTable();
+
+    //! @name Table definition
+    //! These methods must be called before build().
+    //@{
+
+    //! Set the compositions of the fuel and oxidizer streams, as mole
+    //! fractions. Species not listed are set to zero.
+    void setStreams(const compositionMap& fuel, const compositionMap& oxidizer);
+
+    //! Set the compositions of the fuel and oxidizer streams, as mole
+    //! fractions given as strings, e.g. "CH4:1.0" and "O2:1.0, N2:3.76".
+    void setStreams(const std::string& fuel, const std::string& oxidizer);
+
+    //! Set the range of enthalpies covered by the table, as the temperatures
+    //! [K] of the unreacted mixture at the minimum and maximum enthalpies.
+    //! Defaults to 300 K and 1500 K.
+    void setTemperatureRange(double Tmin, double Tmax);
+
+    //! Set the range of pressures [Pa] covered by the table. Defaults to
+    //! one atmosphere.
+    void setPressureRange(double Pmin, double Pmax);
+
+    //! Set the maximum interpolation errors in the temperature [K] and in the
+    //! mass fractions. Defaults to 1 K and 1e-3.
+    void setTolerances(double Ttol, double Ytol);
+
+    //! Set the number of cells in the initial uniform grid in the mixture
+    //! fraction, enthalpy and pressure directions, and the maximum number of
+    //! times each cell can be bisected. Defaults to (8, 4, 2) and 6.
+    void setGrid(size_t nZ, size_t nh, size_t nP, size_t maxLevel);
+    //@}
+
+    //! Build the table
+    void build();
+
+    //! Find the equilibrium state by interpolation in the table.
+    /*!
+     * Throws an exception if the state is outside the range of the table.
+     *
+     * @param Z       Mixture fraction
+     * @param h       Specific enthalpy [J/kg]
+     * @param P       Pressure [Pa]
+     * @param[out] Y  Equilibrium mass fractions. Length nSpecies(). Not
+     *                computed if null.
+     * @returns the equilibrium temperature [K]
+     */
+    double lookup(double Z, double h, double P, double* Y=0) const;
+
+    //! Set *phase* to the equilibrium state found by interpolation in the
+    //! table. *phase* must have the same species as the phase used to
+    //! construct the table.
+    void setState(ThermoPhase& phase, double Z, double h, double P) const;
+
+    //! Mass fractions of the unreacted mixture with mixture fraction *Z*
+    void getUnreactedMassFractions(double Z, double* Y) const;
+
+    //! Save the table to an XML file
+    void save(const std::string& filename) const;
+
+    //! Load a table previously saved with save(). The species of the table
+    //! must match those of the phase used to construct this object.
+    void load(const std::string& filename);
+
+    //! Number of species in the phase
+    size_t nSpecies() const {
+        return m_nsp;
+    }
+
+    //! Number of cells which are not further refined
+    size_t nCells() const;
+
+    //! Number of cells at the maximum level of refinement. The interpolation
+    //! error in these cells has not been checked against the tolerances. If
+    //! it is not zero, the initial grid or the number of levels may need to
+    //! be increased.
+    size_t nFinestCells() const;
+
+    //! Number of points at which the equilibrium state is tabulated
+    size_t nPoints() const {
+        return m_T.size();
+    }
+
+    //! True if the table has been built or loaded
+    bool ready() const {
+        return !m_cells.empty();
+    }
+
+protected:
+    //! A cell of the table. The children of a refined cell are stored
+    //! contiguously, and are numbered in the same way as its corners: bit 0 is
+    //! set for the upper half in the mixture fraction direction, bit 1 for the
+    //! enthalpy direction, and bit 2 for the pressure direction.
+    struct Cell {
+        //! Index of the first child, or -1 if the cell is not refined
+        int child;
+        //! Indices of the tabulated points at the corners
+        int corner[8];
+    };
+
+    //! Copy of the phase used by one thread
+    struct Worker;
+
+    //! Number of coordinate directions (2 or 3)
+    size_t nDims() const {
+        return (m_Pmax > m_Pmin) ? 3 : 2;
+    }
+
+    //! Enthalpy [J/kg] of the unreacted mixture with mixture fraction *Z* at
+    //! the minimum (*upper* = false) or maximum temperature of the table
+    double unreactedEnthalpy(double Z, bool upper) const;
+
+    //! Mixture fraction, enthalpy and pressure at a point of the lattice
+    void latticeState(size_t i, size_t j, size_t k, double& Z, double& h,
+                      double& P) const;
+
+    //! Return the index of the lattice point (*i*, *j*, *k*), adding it to
+    //! the list of points to be computed if it is new.
+    int addPoint(size_t i, size_t j, size_t k);
+
+    //! Compute the equilibrium states at all points added since the last call
+    void computePoints();
+
+    //! Compute the equilibrium states at points *i0* to *i1*-1 with worker *w*
+    void computeBlock(Worker& w, size_t i0, size_t i1);
+
+    //! Interpolate the temperature and the mass fractions at the normalized
+    //! position *x* within *cell*, and return the temperature.
+    double interpolate(const Cell& cell, const double* x, double* Y) const;
+
+    ThermoPhase& m_phase;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    size_t m_nsp;
+
+    //! Mass fractions of the fuel and oxidizer streams
+    vector_fp m_Yfuel, m_Yox;
+
+    //! Enthalpies [J/kg] of the two streams at the minimum and maximum
+    //! temperatures
+    double m_hFuel[2], m_hOx[2];
+
+    double m_Tmin, m_Tmax;
+    double m_Pmin, m_Pmax;
+    double m_Ttol, m_Ytol;
+
+    //! Number of cells in each direction in the initial grid
+    size_t m_n0[3];
+    size_t m_maxLevel;
+
+    std::vector<Cell> m_cells;
+
+    //! Tabulated temperatures, and mass fractions (stored by point)
+    vector_fp m_T, m_Y;
+
+    //! Lattice coordinates of the points which have not been computed
+    std::vector<size_t> m_pending;
+
+    //! Map from the lattice coordinates to the index of each point. Only used
+    //! while building the table.
+    std::map<size_t, int> m_pointIndex;
+};
+
+}
+
+#endif
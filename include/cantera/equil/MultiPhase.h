@@ -560,6 +560,21 @@ private:
     double equilibrate_MultiPhaseEquil(int XY, doublereal err, int maxsteps,
                                        int maxiter, int loglevel);
 
+    //! Set the mixture to a state of chemical equilibrium at fixed enthalpy
+    //! and pressure (HP), entropy and pressure (SP), or internal energy and
+    //! volume (UV) by Newton iteration on the temperature (and, for UV, the
+    //! pressure).
+    /*!
+     * Each iteration solves the equilibrium problem at fixed T and P with
+     * MultiPhaseEquil, starting from the composition found in the previous
+     * iteration, and uses the equilibrium derivatives computed by
+     * MultiPhaseEquil::getEquilibriumDerivatives() to update T and P. The
+     * arguments are the same as for equilibrate_MultiPhaseEquil(). Throws an
+     * exception if the iteration does not converge.
+     */
+    double equilibrate_Newton(int XY, doublereal err, int maxsteps,
+                              int maxiter, int loglevel);
+
     //! Vector of the number of moles in each phase.
     /*!
      * Length = m_np, number of phases.
@@ -653,6 +668,9 @@ private:
      *      species in all phases.
      */
     mutable vector_fp m_elemAbundances;
+
+    //! Work array of the moles of each species. Length = m_nsp.
+    vector_fp m_workMoles;
 };
 
 //! Function to output a MultiPhase description to a stream
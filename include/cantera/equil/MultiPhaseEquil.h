@@ -79,6 +79,24 @@ public:
 
     void reportCSV(const std::string& reportFile);
 
+    //! Compute the derivatives of the total enthalpy, entropy and volume of
+    //! the mixture, allowing the composition to shift so as to remain at
+    //! equilibrium.
+    /*!
+     * Should be called after equilibrate(). The changes in the extents of the
+     * formation reactions of the non-component species are found from the
+     * linearized equilibrium conditions for these reactions, using the
+     * derivatives of the chemical potentials of ideal solutions with respect
+     * to the species mole numbers.
+     *
+     * @param[out] dT  Derivatives of H [J/K], S [J/K^2] and V [m^3/K] with
+     *     respect to temperature at constant pressure. Length 3.
+     * @param[out] dP  Derivatives of H [m^3], S [m^3/K] and V [m^3/Pa] with
+     *     respect to pressure at constant temperature. Length 3. If null, the
+     *     volume derivatives are not computed, and dT[2] is not set.
+     */
+    void getEquilibriumDerivatives(double* dT, double* dP=0);
+
     double phaseMoles(size_t iph) const;
 
 protected:
@@ -171,6 +189,7 @@ protected:
     vector_fp m_work, m_work2, m_work3;
     vector_fp m_moles, m_lastmoles, m_dxi;
     vector_fp m_deltaG_RT, m_mu;
+    vector_fp m_nu; //!< Stoichiometric vector used by computeReactionSteps()
     std::vector<bool> m_majorsp;
     std::vector<size_t> m_sortindex;
     vector_int m_lastsort;
@@ -0,0 +1,120 @@
+/**
+ *  @file BatchSurfaceSolver.h
+ *  Declarations for solving many independent pseudo-steady state surface
+ *  problems (see \ref kineticsmgr and class
+ *  \link Cantera::BatchSurfaceSolver BatchSurfaceSolver\endlink).
+ */
+
+#ifndef CT_BATCHSURFACESOLVER_H
+#define CT_BATCHSURFACESOLVER_H
+
+#include "cantera/kinetics/InterfaceKinetics.h"
+#include "cantera/base/WorkerThreads.h"
+
+namespace Cantera
+{
+
+class ImplicitSurfChem;
+class SurfPhase;
+
+//! Solves many independent pseudo-steady state surface problems which share
+//! the same reaction mechanism
+/*!
+ * Each problem is defined by the temperature, pressure and composition of the
+ * first phase of an InterfaceKinetics object (usually the gas) and an initial
+ * guess for the coverages of its surface phase. The surface coverages are
+ * solved for with ImplicitSurfChem::solvePseudoSteadyStateProblem(), and the
+ * steady state coverages and net production rates of all species are
+ * returned. The states of the remaining phases, other than their temperature
+ * and pressure, are those of the phases of the original kinetics object at
+ * the time solve() is called.
+ *
+ * The problems are divided into contiguous blocks, one for each worker
+ * thread. The threads are created by the constructor and reused by each call
+ * to solve(), with the first block solved by the calling thread. Each worker
+ * owns copies of the phases and of the InterfaceKinetics object, created from
+ * the XML definitions of the original phases, as well as an ImplicitSurfChem
+ * object whose work arrays are reused for all of its problems. After the first problem, each worker first attempts a direct
+ * Newton solve from the initial guess, and only falls back to pseudo-time
+ * stepping if that fails. If warm starts are enabled, the initial guess for
+ * each problem is the solution of the previous problem in the same block.
+ *
+ * Since the block boundaries depend on the number of threads, results
+ * obtained with different numbers of threads agree only to within the
+ * tolerances of the surface solver.
+ *
+ * @ingroup kineticsmgr
+ */
+class BatchSurfaceSolver
+{
+public:
+    //! Constructor
+    /*!
+     * @param kin       Kinetics manager defining the surface problem. All of
+     *                  its phases must have been created from input files.
+     *                  Only the rate multipliers are copied to the workers, so
+     *                  an exception is thrown if reactions have been added to,
+     *                  removed from or modified in the kinetics manager.
+     *                  Such changes must not be made after the constructor is
+     *                  called.
+     * @param nThreads  Number of worker threads. If zero, the number of
+     *                  hardware threads is used.
+     */
+    BatchSurfaceSolver(InterfaceKinetics& kin, size_t nThreads = 0);
+    ~BatchSurfaceSolver();
+
+    //! Number of worker threads
+    size_t nThreads() const {
+        return m_workers.size();
+    }
+
+    //! Use the solution of the previous problem solved by the same worker as
+    //! the initial guess, instead of the coverages passed to solve()
+    void setWarmStart(bool warm) {
+        m_warmStart = warm;
+    }
+
+    //! Solve a set of pseudo-steady state surface problems
+    /*!
+     * @param n         Number of problems
+     * @param T         Temperatures [K]. Length *n*.
+     * @param P         Pressures [Pa]. Length *n*.
+     * @param X         Mole fractions of the species in the first phase of
+     *                  the kinetics manager. Length *n* times the number of
+     *                  species in that phase, stored by problem.
+     * @param[in,out] coverages  Initial guess for the surface coverages on
+     *                  input, and the steady state coverages on output.
+     *                  Length *n* times the number of surface species.
+     * @param[out] sdot Net production rates of all species in the kinetics
+     *                  manager at the steady state [kmol/m^2/s]. Length *n*
+     *                  times Kinetics::nTotalSpecies(). May be null.
+     */
+    void solve(size_t n, const double* T, const double* P, const double* X,
+               double* coverages, double* sdot=0);
+
+protected:
+    //! Copies of the phases and the kinetics manager used by one thread
+    struct Worker;
+
+    //! Solve problems *i0* to *i1*-1 using worker *w*
+    void solveBlock(Worker& w, size_t i0, size_t i1, const double* T,
+                    const double* P, const double* X, double* coverages,
+                    double* sdot);
+
+    //! The original kinetics manager
+    InterfaceKinetics& m_kin;
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+
+    //! Threads used to run the workers
+    std::unique_ptr<WorkerThreads> m_threads;
+
+    //! Index of the surface phase in the kinetics manager
+    size_t m_surfIndex;
+
+    bool m_warmStart;
+};
+
+}
+
+#endif
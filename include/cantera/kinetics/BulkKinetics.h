@@ -40,7 +40,21 @@ public:
     virtual void setMultiplier(size_t i, double f);
     virtual void invalidateCache();
 
+    virtual void setArrheniusParameters(size_t i, double A, double b,
+                                        double Ea_R);
+    virtual void setArrheniusParameters(const double* A, const double* b,
+                                        const double* Ea_R);
+    virtual void getArrheniusParameters(double* A, double* b, double* Ea_R);
+
 protected:
+    virtual void clearReactionData();
+
+    //! Return the Arrhenius expression of reaction *i* used by
+    //! setArrheniusParameters(), or null if there is no such expression.
+    virtual Arrhenius* arrheniusRate(size_t i) {
+        return m_rates.rate(i);
+    }
+
     virtual void addElementaryReaction(ElementaryReaction& r);
     virtual void modifyElementaryReaction(size_t i, ElementaryReaction& rNew);
 
@@ -54,6 +54,24 @@ public:
         m_falloff[m_indices[rxn]] = f;
     }
 
+    /*!
+     * Set the parameters of the falloff function for reaction *rxn*, keeping
+     * the type of the function. If the falloff function is shared with
+     * another object, such as the Reaction it was installed from, it is
+     * replaced by a new falloff function. Otherwise, it is modified in place.
+     *
+     * @param rxn   External reaction index
+     * @param c     Parameters, as used by Falloff::init()
+     */
+    void setParameters(size_t rxn, const vector_fp& c) {
+        shared_ptr<Falloff>& f = m_falloff[m_indices.at(rxn)];
+        if (f.use_count() > 1) {
+            f = newFalloff(f->getType(), c);
+        } else {
+            f->init(c);
+        }
+    }
+
     //! Size of the work array required to store intermediate results.
     size_t workSize() {
         return m_worksize;
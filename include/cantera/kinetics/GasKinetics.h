@@ -62,6 +62,13 @@ public:
     virtual void invalidateCache();
     //@}
 
+    virtual void setLowPressureArrheniusParameters(size_t i, double A,
+                                                   double b, double Ea_R);
+    virtual void setFalloffParameters(size_t i, const vector_fp& c);
+    virtual void setPlogParameters(size_t i, size_t j, double A, double b,
+                                   double Ea_R);
+    virtual void setChebyshevCoeffs(size_t i, const double* coeffs);
+
     void updateROP();
 
     //! Update temperature-dependent portions of reaction rates and falloff
@@ -75,6 +82,9 @@ public:
     virtual void update_rates_C();
 
 protected:
+    virtual void clearReactionData();
+    virtual Arrhenius* arrheniusRate(size_t i);
+
     //! Reaction index of each falloff reaction
     std::vector<size_t> m_fallindx;
 
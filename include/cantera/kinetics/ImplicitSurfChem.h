@@ -111,6 +111,12 @@ public:
     void solvePseudoSteadyStateProblem(int ifuncOverride = -1,
                                        doublereal timeScaleOverride = 1.0);
 
+    //! Set the number of threads used to evaluate the Jacobian in
+    //! solvePseudoSteadyStateProblem(). See solveSP::setJacobianThreads().
+    //! The kinetics managers must not be modified after the first call to
+    //! solvePseudoSteadyStateProblem() if more than one thread is used.
+    void setJacobianThreads(size_t nThreads);
+
     // overloaded methods of class FuncEval
 
     //! Return the number of equations
@@ -237,7 +243,7 @@ protected:
     size_t m_numTotalSpecies;
 
     std::vector<vector_int> pLocVec;
-    //! Pointer to the CVODE integrator
+    //! Pointer to the CVODE integrator. Created by initialize().
     std::unique_ptr<Integrator> m_integ;
     doublereal m_atol, m_rtol; // tolerances
     doublereal m_maxstep; //!< max step size
@@ -271,6 +277,9 @@ protected:
      */
     std::unique_ptr<solveSP> m_surfSolver;
 
+    //! Number of threads used by #m_surfSolver to evaluate the Jacobian
+    size_t m_jacThreads;
+
     //! If true, a common temperature and pressure for all surface and bulk
     //! phases associated with the surface problem is imposed
     bool m_commonTempPressForPhases;
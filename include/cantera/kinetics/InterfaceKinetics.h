@@ -133,6 +133,31 @@ public:
      */
     doublereal electrochem_beta(size_t irxn) const;
 
+    //! Get the derivatives of the net rates of progress with respect to the
+    //! electric potential of phase *n*.
+    /*!
+     * Only the charge transfer reactions depend on the electric potentials.
+     * The forward rate of progress of charge transfer reaction *i* is
+     * proportional to exp(-beta_i dE_i / RT) and the reverse rate of progress
+     * to exp((1-beta_i) dE_i / RT), where dE_i is the change in electric
+     * potential energy due to the reaction, so the derivatives are evaluated
+     * analytically. Adjustments made to the rates of progress for phases that
+     * do not exist (see setPhaseExistence()) are not differentiated.
+     *
+     * @param n     Index of the phase in this kinetics object
+     * @param drop  Output vector of length nReactions(). Units are
+     *              kmol/m^2/s/V for an interface.
+     */
+    void getNetRatesOfProgress_ddPhi(size_t n, doublereal* drop);
+
+    //! Net rate at which positive charge is transferred into phase *n* by
+    //! the charge transfer reactions, per unit area of the interface [A/m^2]
+    doublereal currentDensity(size_t n);
+
+    //! Derivative of currentDensity(n) with respect to the electric potential
+    //! of phase *m* [A/m^2/V]
+    doublereal currentDensity_ddPhi(size_t n, size_t m);
+
     virtual bool isReversible(size_t i) {
         if (std::find(m_revindex.begin(), m_revindex.end(), i)
                 < m_revindex.end()) {
@@ -205,6 +230,15 @@ public:
     virtual void resizeSpecies();
     virtual bool addReaction(shared_ptr<Reaction> r);
     virtual void modifyReaction(size_t i, shared_ptr<Reaction> rNew);
+
+    //! Set the Arrhenius parameters of reaction *i*. For sticking reactions,
+    //! *A* is the sticking coefficient. The coverage dependencies of the
+    //! reaction are unchanged.
+    virtual void setArrheniusParameters(size_t i, double A, double b,
+                                        double Ea_R);
+    virtual void setArrheniusParameters(const double* A, const double* b,
+                                        const double* Ea_R);
+    virtual void getArrheniusParameters(double* A, double* b, double* Ea_R);
     //! @}
 
     //! Internal routine that updates the Rates of Progress of the reactions
@@ -220,6 +254,12 @@ public:
      *       m_kdata->m_rfn
      *       m_rates.
      *       updateKc();
+     *
+     *  The equilibrium constants are only recomputed if the temperature,
+     *  the pressure of any phase, the electric potentials or the surface site
+     *  density have changed. The forward rate constants are additionally
+     *  recomputed when the surface coverages have changed, if any reaction
+     *  has a coverage dependent rate.
      */
     void _update_rates_T();
 
@@ -376,6 +416,8 @@ public:
     virtual void determineFwdOrdersBV(ElectrochemicalReaction& r, vector_fp& fwdFullorders);
 
 protected:
+    virtual void clearReactionData();
+
     //! Build a SurfaceArrhenius object from a Reaction, taking into account
     //! the possible sticking coefficient form and coverage dependencies
     //! @param i  Reaction number
@@ -401,8 +443,35 @@ protected:
      */
     Rate1<SurfaceArrhenius> m_rates;
 
+    //! Flag forcing the rate constants and the equilibrium constants to be
+    //! recomputed on the next call to _update_rates_T()
     bool m_redo_rates;
 
+    //! Flag indicating that the electric potential of a phase has changed
+    //! since the rate constants were last evaluated. Only the potential
+    //! dependent parts of the rate constants need to be recomputed.
+    bool m_redo_phi;
+
+    //! Temperature of each phase at which #m_rkcn was last evaluated
+    vector_fp m_phaseTemp;
+
+    //! Pressure of each phase at which #m_rkcn was last evaluated
+    vector_fp m_phasePres;
+
+    //! Surface site density at which #m_rkcn was last evaluated
+    doublereal m_siteDensity;
+
+    //! Value of stateMFNumber() of the surface phase at which the coverage
+    //! dependent parts of #m_rates were last evaluated
+    int m_covStateNum;
+
+    //! Coverage-independent parts of the forward rate constants, evaluated
+    //! at #m_temp
+    vector_fp m_rfnBase;
+
+    //! Indices of the reactions with coverage dependent rate constants
+    std::vector<size_t> m_covDependentRxns;
+
     //! Vector of irreversible reaction numbers
     /*!
      * vector containing the reaction numbers of irreversible reactions.
@@ -476,19 +545,15 @@ protected:
      */
     vector_fp m_phi;
 
-    //! Vector of potential energies due to Voltages
-    /*!
-     * Length is the number of species in kinetics mech. It's used to store the
-     * potential energy due to the voltage.
-     */
-    vector_fp m_pot;
-
     //! Storage for the net electric energy change due to reaction.
     /*!
      * Length is number of reactions. It's used to store the net electric
      * potential energy change due to the reaction.
      *
      *  deltaElectricEnergy_[jrxn] = sum_i ( F V_i z_i nu_ij)
+     *
+     * Only the entries for the charge transfer reactions, m_ctrxn[], are
+     * evaluated.
      */
     vector_fp deltaElectricEnergy_;
 
@@ -546,6 +611,35 @@ protected:
      */
     vector_int m_ctrxn_ecdf;
 
+    //! Net charge, in units of the elementary charge, transferred into each
+    //! phase by each charge transfer reaction
+    /*!
+     *  m_ctrxn_dq[i][n] = sum_{k in phase n} ( z_k nu_k,irxn ), where
+     *  irxn = m_ctrxn[i]. Precomputed so that the electric potential energy
+     *  change of a reaction can be evaluated from the phase potentials alone.
+     */
+    std::vector<vector_fp> m_ctrxn_dq;
+
+    //! Transfer coefficient applied to the forward rate constant of each
+    //! charge transfer reaction.
+    /*!
+     *  Equal to m_beta[i] for reactions evaluated using the standard forward
+     *  and reverse rates (m_ctrxn_BVform[i] == 0), and zero for reactions
+     *  evaluated in Butler-Volmer form, whose rate constants are not
+     *  corrected for the potential difference.
+     */
+    vector_fp m_ctrxn_betaKf;
+
+    //! Indices into m_ctrxn[] of the reactions whose rate constant is given
+    //! in a different formulation from the one used to evaluate them, i.e.
+    //! m_ctrxn_ecdf[i] == 1 and m_ctrxn_BVform[i] == 0, or
+    //! m_ctrxn_ecdf[i] == 0 and m_ctrxn_BVform[i] != 0.
+    std::vector<size_t> m_ctrxn_ecdfConv;
+
+    //! For each entry in m_ctrxn_ecdfConv, +1 to convert an exchange current
+    //! density to a chemical rate constant, and -1 for the reverse.
+    vector_fp m_ctrxn_ecdfSign;
+
     //! Vector of standard concentrations
     /*!
      *   Length number of kinetic species
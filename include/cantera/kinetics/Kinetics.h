@@ -412,6 +412,30 @@ public:
      */
     virtual void getNetRatesOfProgress(doublereal* netROP);
 
+    //! Update the internal arrays of rates of progress for the current state.
+    //! Their contents can then be accessed without copying through
+    //! fwdRatesOfProgress(), revRatesOfProgress() and netRatesOfProgress().
+    void updateRatesOfProgress() {
+        updateROP();
+    }
+
+    //! Forward rates of progress computed by the most recent call to
+    //! updateRatesOfProgress() or to any of the methods which return rates.
+    //! The reference remains valid until reactions are added or removed.
+    const vector_fp& fwdRatesOfProgress() const {
+        return m_ropf;
+    }
+
+    //! Reverse rates of progress. See fwdRatesOfProgress().
+    const vector_fp& revRatesOfProgress() const {
+        return m_ropr;
+    }
+
+    //! Net rates of progress. See fwdRatesOfProgress().
+    const vector_fp& netRatesOfProgress() const {
+        return m_ropnet;
+    }
+
     //! Return a vector of Equilibrium constants.
     /*!
      *  Return the equilibrium constants of the reactions in concentration
@@ -777,6 +801,44 @@ public:
      */
     virtual void modifyReaction(size_t i, shared_ptr<Reaction> rNew);
 
+    /**
+     * Remove reaction *i* from the mechanism. The indices of the following
+     * reactions are reduced by one. Since this requires the data for all
+     * reactions to be rebuilt, removing several reactions should be done
+     * between calls to beginEdit() and commitEdit(). If no edit is in
+     * progress, the mechanism is rebuilt immediately.
+     */
+    void removeReaction(size_t i);
+
+    /**
+     * Begin a set of changes to the reaction mechanism. Until commitEdit()
+     * is called, addReaction() and removeReaction() only update the list of
+     * reactions, and modifyReaction() only updates the data of reactions
+     * which existed before the edit began and while no reactions have been
+     * removed. The data structures used to evaluate the reaction rates
+     * (stoichiometry, rate coefficient and third body calculators, etc.) are
+     * then rebuilt once by commitEdit(). The reaction rates may not be
+     * evaluated while an edit is in progress.
+     */
+    void beginEdit();
+
+    /**
+     * Rebuild the data structures for the reactions added, modified or
+     * removed since the call to beginEdit(). If reactions were only added
+     * or modified, the data for the existing reactions is kept. Errors which
+     * depend on the type of kinetics manager, such as undefined third body
+     * species, are raised here for reactions added during the edit. In that
+     * case, the list of reactions is left unchanged and the edit remains in
+     * progress, so that the invalid reactions can be removed. Reaction rate
+     * multipliers are preserved.
+     */
+    void commitEdit();
+
+    //! True if an edit of the reaction mechanism is in progress
+    bool editing() const {
+        return m_editing;
+    }
+
     /**
      * Return the Reaction object for reaction *i*.
      */
@@ -830,6 +892,63 @@ public:
 
     virtual void invalidateCache() {};
 
+    //@}
+    //! @name Setting Rate Parameters
+    /*!
+     * These methods overwrite the parameters of the rate expressions of
+     * existing reactions in place, without constructing new Reaction objects.
+     * They are intended for applications such as mechanism optimization and
+     * uncertainty quantification, where the same mechanism is evaluated with
+     * many different sets of rate parameters. The Reaction objects returned
+     * by reaction() are not modified. Activation energies are given divided
+     * by the gas constant, i.e. as activation temperatures [K].
+     *
+     * These methods may not be used for reactions added or removed during an
+     * edit started with beginEdit(). The parameters set by these methods are
+     * replaced by those of the Reaction objects when the data for all
+     * reactions is rebuilt, i.e. by commitEdit() after reactions have been
+     * removed, or if commitEdit() fails.
+     */
+    //@{
+
+    //! Set the parameters of the Arrhenius rate expression of reaction *i*.
+    //! For falloff and chemically activated reactions, this is the high
+    //! pressure limit.
+    virtual void setArrheniusParameters(size_t i, double A, double b,
+                                        double Ea_R);
+
+    //! Set the parameters of the Arrhenius rate expressions of all reactions.
+    //! Each array has length nReactions(). Entries for reactions without a
+    //! single Arrhenius rate expression, or which are NaN, are ignored.
+    virtual void setArrheniusParameters(const double* A, const double* b,
+                                        const double* Ea_R);
+
+    //! Get the parameters of the Arrhenius rate expressions of all reactions,
+    //! as set by setArrheniusParameters(). Each array has length
+    //! nReactions(). The entries for reactions without a single Arrhenius
+    //! rate expression are set to NaN.
+    virtual void getArrheniusParameters(double* A, double* b,
+                                        double* Ea_R);
+
+    //! Set the parameters of the low pressure limit rate of the falloff or
+    //! chemically activated reaction *i*.
+    virtual void setLowPressureArrheniusParameters(size_t i, double A,
+                                                   double b, double Ea_R);
+
+    //! Set the parameters of the falloff function of reaction *i*, in the
+    //! form used by Falloff::init(). The type of the falloff function is
+    //! unchanged.
+    virtual void setFalloffParameters(size_t i, const vector_fp& c);
+
+    //! Set the parameters of the Arrhenius expression *j* of the P-log
+    //! reaction *i*, where the expressions are numbered as in Plog::rates().
+    virtual void setPlogParameters(size_t i, size_t j, double A, double b,
+                                   double Ea_R);
+
+    //! Set the coefficients of the Chebyshev reaction *i*. See
+    //! ChebyshevRate::setCoeffs().
+    virtual void setChebyshevCoeffs(size_t i, const double* coeffs);
+
     //@}
 
     /**
@@ -874,6 +993,35 @@ protected:
         throw NotImplementedError("Kinetics::updateROP");
     }
 
+    /**
+     * Clear the data for all reactions, leaving only the phases and species.
+     * Used by commitEdit() before adding the reactions again. Derived classes
+     * which store their own data for each reaction should override this
+     * method and call the base class method.
+     */
+    virtual void clearReactionData();
+
+    //! True if the data for reaction *i* is not up to date because an edit
+    //! of the mechanism is in progress. Used by derived classes to skip
+    //! updating their own data in modifyReaction().
+    bool editDeferred(size_t i) const {
+        return m_editing && (m_editRebuild || i >= m_editBuilt);
+    }
+
+    //! Check that the rate parameters of reaction *i* can be set in place,
+    //! i.e. that *i* is a valid index and its data is not affected by an
+    //! edit in progress. If *i* is npos, check that no edit is in progress.
+    void checkEditState(const std::string& func, size_t i=npos) const;
+
+    //! Throw an exception if an edit of the mechanism is in progress. Used by
+    //! the methods which evaluate the reaction rates, since the data they use
+    //! is not rebuilt until commitEdit() is called.
+    void checkNotEditing(const char* func) const {
+        if (m_editing) {
+            checkEditState(func);
+        }
+    }
+
     //! Check whether `r1` and `r2` represent duplicate stoichiometries
     //! This function returns a ratio if two reactions are duplicates of
     //! one another, and 0.0 otherwise.
@@ -987,6 +1135,17 @@ protected:
     //! @see skipUndeclaredThirdBodies()
     bool m_skipUndeclaredThirdBodies;
 
+    //! @see beginEdit()
+    bool m_editing;
+
+    //! True if reactions have been removed since beginEdit(), so that the
+    //! data for all reactions needs to be rebuilt
+    bool m_editRebuild;
+
+    //! Number of reactions whose data was up to date when beginEdit() was
+    //! called
+    size_t m_editBuilt;
+
 private:
     std::map<size_t, std::vector<grouplist_t> > m_rgroups;
     std::map<size_t, std::vector<grouplist_t> > m_pgroups;
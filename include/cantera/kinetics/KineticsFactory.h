@@ -61,7 +61,7 @@ public:
      *              are e.g. bulk phases adjacent to a reacting surface.
      * @return Pointer to the new kinetics manager.
      */
-    virtual Kinetics* newKinetics(XML_Node& phase, std::vector<ThermoPhase*> th);
+    virtual Kinetics* newKinetics(const XML_Node& phase, std::vector<ThermoPhase*> th);
 
     /**
      * Return a new, empty kinetics manager.
@@ -79,7 +79,7 @@ private:
  *  @deprecated The `KineticsFactory*` argument to this function is deprecated
  *     and will be removed after Cantera 2.3.
  */
-inline Kinetics* newKineticsMgr(XML_Node& phase,
+inline Kinetics* newKineticsMgr(const XML_Node& phase,
                                 std::vector<ThermoPhase*> th, KineticsFactory* f=0)
 {
     if (f == 0) {
@@ -108,6 +108,21 @@ inline Kinetics* newKineticsMgr(const std::string& model, KineticsFactory* f=0)
     }
     return f->newKinetics(model);
 }
+
+//! Check that a copy of a kinetics manager has the same reactions and rate
+//! constants as the original
+/*!
+ * Copies created from the input file definition of a kinetics manager do not
+ * include any reactions which were added, removed or modified after the
+ * original was created. Both kinetics managers must be at the same state.
+ *
+ * @param kin        The original kinetics manager
+ * @param copy       The copy of the kinetics manager
+ * @param procedure  Name of the calling function, used in the error message
+ * @throws CanteraError if the reactions or rate constants differ
+ */
+void checkKineticsCopy(Kinetics& kin, Kinetics& copy,
+                       const std::string& procedure);
 }
 
 #endif
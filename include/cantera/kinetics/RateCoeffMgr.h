@@ -54,6 +54,16 @@ public:
         }
     }
 
+    //! Update the concentration-dependent parts of the rate coefficient for
+    //! reaction *irxn* only.
+    /*!
+     *  @param irxn Reaction number in the kinetics mechanism, which must have
+     *      been installed in this object
+     */
+    void update_C(size_t irxn, const doublereal* c) {
+        m_rates[m_indices.at(irxn)].update_C(c);
+    }
+
     /**
      * Write the rate coefficients into array values. Each calculator writes one
      * entry in values, at the location specified by the reaction number when it
@@ -68,10 +78,47 @@ public:
         }
     }
 
+    /**
+     * Write the coverage-independent parts of the rate coefficients into
+     * array values. Used together with coverageFactor() by InterfaceKinetics
+     * so that the temperature-dependent part of each rate coefficient is only
+     * recomputed when the temperature changes.
+     */
+    void updateBase(doublereal T, doublereal logT, doublereal* values) {
+        doublereal recipT = 1.0/T;
+        for (size_t i = 0; i != m_rates.size(); i++) {
+            values[m_rxn[i]] = m_rates[i].updateBaseRC(logT, recipT);
+        }
+    }
+
+    //! Return the multiplier applied by the coverage dependence to the rate
+    //! coefficient of reaction *irxn*, as computed by the last call to
+    //! update_C().
+    /*!
+     *  @param irxn Reaction number in the kinetics mechanism, which must have
+     *      been installed in this object
+     */
+    double coverageFactor(size_t irxn, doublereal recipT) const {
+        return m_rates[m_indices.at(irxn)].coverageFactor(recipT);
+    }
+
     size_t nReactions() const {
         return m_rates.size();
     }
 
+    //! Return a pointer to the rate coefficient calculator for reaction
+    //! *rxnNumber*, or null if that reaction is not handled by this object.
+    //! Used to modify the rate parameters in place.
+    R* rate(size_t rxnNumber) {
+        auto iter = m_indices.find(rxnNumber);
+        return (iter != m_indices.end()) ? &m_rates[iter->second] : nullptr;
+    }
+
+    const R* rate(size_t rxnNumber) const {
+        auto iter = m_indices.find(rxnNumber);
+        return (iter != m_indices.end()) ? &m_rates[iter->second] : nullptr;
+    }
+
     //! Return effective preexponent for the specified reaction.
     /*!
      *  Returns effective preexponent, accounting for surface coverage
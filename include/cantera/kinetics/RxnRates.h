@@ -44,6 +44,10 @@ public:
     /// @param E Activation energy in temperature units. Kelvin.
     Arrhenius(doublereal A, doublereal b, doublereal E);
 
+    //! Replace the parameters of the rate expression. The arguments are the
+    //! same as for the constructor.
+    void setParameters(double A, double b, double E);
+
     //! Update concentration-dependent parts of the rate coefficient.
     /*!
      *   For this class, there are no concentration-dependent parts, so this
@@ -124,6 +128,22 @@ public:
     SurfaceArrhenius();
     explicit SurfaceArrhenius(double A, double b, double Ta);
 
+    //! Replace the coverage-independent parameters of the rate expression.
+    //! The coverage dependencies are unchanged.
+    void setParameters(double A, double b, double Ta) {
+        m_A = A;
+        m_b = b;
+        m_E = Ta;
+    }
+
+    //! Get the coverage-independent parameters of the rate expression, as
+    //! given to the constructor or setParameters().
+    void getParameters(double& A, double& b, double& Ta) const {
+        A = m_A;
+        b = m_b;
+        Ta = m_E;
+    }
+
     //! Add a coverage dependency for species *k*, with pre-exponential
     //! dependence *a*, rate constant exponential dependency *m*, and activation
     //! energy dependence *e*, where *e* is in Kelvin, i.e. energy divided by
@@ -160,6 +180,27 @@ public:
                               (m_E + m_ecov)*recipT + m_mcov);
     }
 
+    //! Return the coverage-independent part of the rate constant,
+    //! \f$ A T^b \exp(-E/RT) \f$.
+    doublereal updateBaseRC(doublereal logT, doublereal recipT) const {
+        return m_A * std::exp(m_b*logT - m_E*recipT);
+    }
+
+    //! Return the factor by which the coverage dependence modifies the rate
+    //! constant, using the coverages given in the last call to update_C().
+    /*!
+     * The product of updateBaseRC() and this factor is equal to the value
+     * returned by updateRC().
+     */
+    doublereal coverageFactor(doublereal recipT) const {
+        return std::exp(std::log(10.0)*m_acov - m_ecov*recipT + m_mcov);
+    }
+
+    //! True if the rate constant depends on any surface coverages
+    bool coverageDependent() const {
+        return !m_sp.empty();
+    }
+
     //! Return the pre-exponential factor *A* (in m, kmol, s to powers depending
     //! on the reaction order) accounting coverage dependence.
     /*!
@@ -287,6 +328,16 @@ public:
     //! reaction.
     std::vector<std::pair<double, Arrhenius> > rates() const;
 
+    //! Number of Arrhenius expressions
+    size_t nRates() const {
+        return rates_.size();
+    }
+
+    //! Replace the Arrhenius expression *j*, where the expressions are
+    //! numbered in the order returned by rates(). The pressure of the
+    //! expression is unchanged.
+    void setRate(size_t j, const Arrhenius& rate);
+
 protected:
     //! log(p) to (index range) in the rates_ vector
     std::map<double, std::pair<size_t, size_t> > pressures_;
@@ -438,6 +489,18 @@ public:
         return chebCoeffs_;
     }
 
+    //! Replace the Chebyshev coefficients, keeping the number of points and
+    //! the temperature and pressure ranges.
+    /*!
+     *  @param coeffs  New coefficients, of length nTemperature() *
+     *      nPressure(), in the same order as coeffs().
+     *
+     *  The new coefficients take effect after the next call to update_C().
+     */
+    void setCoeffs(const double* coeffs) {
+        std::copy(coeffs, coeffs + chebCoeffs_.size(), chebCoeffs_.begin());
+    }
+
 protected:
     double Tmin_, Tmax_; //!< valid temperature range
     double Pmin_, Pmax_; //!< valid pressure range
@@ -14,6 +14,7 @@
 
 #include "cantera/kinetics/InterfaceKinetics.h"
 #include "cantera/numerics/DenseMatrix.h"
+#include "cantera/base/WorkerThreads.h"
 
 //! @defgroup solvesp_methods Surface Problem Solver Methods
 //! @{
@@ -152,7 +153,7 @@ public:
     solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc = BULK_ETCH);
 
     //! Destructor. Deletes the integrator.
-    ~solveSP() {}
+    ~solveSP();
 
 private:
     //! Unimplemented private copy constructor
@@ -188,7 +189,62 @@ public:
     int solveSurfProb(int ifunc, doublereal time_scale, doublereal TKelvin,
                       doublereal PGas, doublereal reltol, doublereal abstol);
 
+    //! Set the number of threads used to evaluate the columns of the
+    //! finite-difference Jacobian.
+    /*!
+     * Each thread other than the calling thread uses its own copies of the
+     * phases and InterfaceKinetics objects of the surface problem, which are
+     * created from the XML definitions of the phases. The additional threads
+     * are created by this function and reused for each Jacobian evaluation.
+     * The Jacobian is identical to the one evaluated by a single thread.
+     *
+     * Because the copies are created from the input files, reactions or
+     * species added to the kinetics managers, and rate parameters changed
+     * with methods such as modifyReaction(), are not included in the copies.
+     * Only the rate multipliers are copied. An exception is thrown if the
+     * reactions or rate constants of a copy differ from those of the
+     * original when the copy is created. Changes made after that are not
+     * detected, and must not be made while more than one thread is used.
+     *
+     * @param nThreads  Number of threads. If zero, the number of hardware
+     *                  threads is used. A value of 1 disables the parallel
+     *                  evaluation.
+     */
+    void setJacobianThreads(size_t nThreads);
+
+    //! Number of threads used to evaluate the Jacobian
+    size_t jacobianThreads() const {
+        return m_jacWorkers.size() + 1;
+    }
+
 private:
+    //! Copies of the surface problem used by one additional thread for
+    //! evaluating Jacobian columns
+    struct JacobianWorker;
+
+    //! Evaluate the columns *c0* to *c1*-1 of the Jacobian for the surface
+    //! species, using the phases and kinetics objects of this object
+    /*!
+     * @param jac     Jacobian matrix
+     * @param resid   Unperturbed residual
+     * @param CSoln   Solution vector. Perturbed in place and restored.
+     * @param CSolnOld  Solution vector at the old time step
+     * @param do_time  Calculate a time dependent residual
+     * @param deltaT   Delta time for time dependent problem.
+     * @param c0  First column
+     * @param c1  One past the last column
+     */
+    void evalJacColumns(DenseMatrix& jac, const doublereal* resid,
+                        doublereal* CSoln, const doublereal* CSolnOld,
+                        bool do_time, doublereal deltaT, size_t c0, size_t c1);
+
+    //! Evaluate the Jacobian columns for the surface species in parallel
+    //! using this object and the objects in m_jacWorkers. Arguments are the
+    //! same as for evalJacColumns().
+    void evalJacColumnsParallel(DenseMatrix& jac, const doublereal* resid,
+                                doublereal* CSoln, const doublereal* CSolnOld,
+                                bool do_time, doublereal deltaT);
+
     //! Printing routine that optionally gets called at the start of every
     //! invocation
     void print_header(int ioflag, int ifunc, doublereal time_scale,
@@ -506,6 +562,17 @@ private:
     //! Newton's method.
     DenseMatrix m_Jac;
 
+    //! Damping factor used in the previous Newton iteration, which limits the
+    //! growth of the damping factor between iterations
+    doublereal m_dampOld;
+
+    //! Copies of the surface problem used for evaluating Jacobian columns on
+    //! additional threads. See setJacobianThreads().
+    std::vector<std::unique_ptr<JacobianWorker>> m_jacWorkers;
+
+    //! Threads used for evaluating Jacobian columns with m_jacWorkers
+    std::unique_ptr<WorkerThreads> m_jacThreads;
+
 public:
     int m_ioflag;
 };
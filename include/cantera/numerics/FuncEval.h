@@ -13,6 +13,9 @@
 
 namespace Cantera
 {
+
+class Array2D;
+
 /**
  *  Virtual base class for ODE right-hand-side function evaluators.
  *  Classes derived from FuncEval evaluate the right-hand-side function
@@ -37,6 +40,21 @@ public:
      */
     virtual void eval(double t, double* y, double* ydot, double* p)=0;
 
+    /**
+     * Evaluate the Jacobian of the right-hand-side function. Called by the
+     * integrator if the problem type includes JAC.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq(). May be perturbed during
+     *     the evaluation, but is restored on return.
+     * @param[out] ydot rate of change of solution vector, length neq()
+     * @param[in] p sensitivity parameter vector, length nparams()
+     * @param[out] j Jacobian matrix, size neq() by neq()
+     */
+    virtual void evalJacobian(double t, double* y, double* ydot, double* p,
+                              Array2D* j) {
+        throw NotImplementedError("FuncEval::evalJacobian");
+    }
+
     /**
      * Fill the solution vector with the initial conditions
      * at initial time t0.
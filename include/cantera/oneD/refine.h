@@ -85,6 +85,10 @@ protected:
     std::map<size_t, int> m_keep;
     std::map<std::string, int> m_c;
     std::vector<bool> m_active;
+
+    //! Work arrays for the values and slopes of a component, and the grid
+    //! spacing
+    vector_fp m_v, m_s, m_dz;
     doublereal m_ratio, m_slope, m_curve, m_prune;
     doublereal m_min_range;
     Domain1D* m_domain;
@@ -927,11 +927,36 @@ public:
         return m_formDH;
     }
 
-    //! Returns a reference to M_Beta_ij
+    //! Returns a reference to M_Beta_ij. Cached activity coefficients are
+    //! discarded, since the values may be changed through the reference.
     Array2D& get_Beta_ij() {
+        invalidateCache();
         return m_Beta_ij;
     }
 
+    //! @name Setting the model parameters
+    //! Each of these discards any activity coefficients that were cached for
+    //! the current state.
+    //! @{
+
+    //! Set A_Debye to a constant value (sqrt(kg/gmol)), replacing a value
+    //! computed from the properties of water.
+    void setA_Debye(double A);
+
+    //! Set B_Debye (sqrt(kg/gmol)/m)
+    void setB_Debye(double B);
+
+    //! Set the B_dot parameter of species *sp* (kg/gmol)
+    void setB_dot(const std::string& sp, double bdot);
+
+    //! Set the ionic radius (m) of species *sp*
+    void setIonicRadius(const std::string& sp, double a);
+
+    //! Set the binary interaction parameter (kg/gmol) between species *sp1*
+    //! and *sp2*, for the forms of the model which use them
+    void setBeta(const std::string& sp1, const std::string& sp2, double beta);
+    //! @}
+
 private:
     //! Static function that implements the non-polar species salt-out
     //! modifications.
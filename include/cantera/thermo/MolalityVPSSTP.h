@@ -264,6 +264,9 @@ public:
      *    - \f$ X_{o,p} = \max (X_{o}^{min}, X_o) \f$
      *    - \f$ X_{o}^{min} \f$ = minimum mole fraction of solvent allowed
      *              in the denominator.
+     *
+     * The result is only recomputed when the composition of the phase has
+     * changed since the last call (see stateMFNumber()).
      */
     void calcMolalities() const;
 
@@ -37,6 +37,13 @@ namespace Cantera
  * \link MultiSpeciesThermo::install_STIT() install_STIT()\endlink
  * is called to install each species into the MultiSpeciesThermo object.
  *
+ * The SpeciesThermoInterpType objects are held by shared pointers and are
+ * treated as immutable. Copies of a MultiSpeciesThermo object (e.g. those
+ * made when duplicating a phase) share the parameterizations with the
+ * original instead of duplicating them. Operations which modify a
+ * parameterization in place, such as modifyOneHf298(), first make a private
+ * copy of it if it is shared.
+ *
  * @ingroup spthermo
  */
 class MultiSpeciesThermo
@@ -215,6 +222,14 @@ private:
     SpeciesThermoInterpType* provideSTIT(size_t k);
     const SpeciesThermoInterpType* provideSTIT(size_t k) const;
 
+    //! Provide the SpeciesThermoInterpType object for species *k*, making a
+    //! private copy of it first if it is shared with any other object. Used
+    //! before modifying a parameterization in place.
+    SpeciesThermoInterpType* provideUniqueSTIT(size_t k);
+
+    //! Share (or, where necessary, copy) the parameterizations from *b*
+    void copySpeciesThermo(const MultiSpeciesThermo& b);
+
 protected:
     //! Mark species *k* as having its thermodynamic data installed
     void markInstalled(size_t k);
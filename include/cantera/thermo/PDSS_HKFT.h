@@ -288,10 +288,33 @@ private:
      *                 - 1 derivative wrt temperature
      *                 - 2 2nd derivative wrt temperature
      *                 - 3 derivative wrt pressure
+     *
+     * The value is looked up in the solvent function cache shared by the HKFT
+     * species of the phase, and only evaluated if (temp, pres) has changed.
      */
     doublereal gstar(const doublereal temp, const doublereal pres,
                      const int ifunc = 0) const;
 
+    //! Relative permittivity of water, or one of its derivatives
+    /*!
+     * Wrapper around WaterProps::relEpsilon() which uses the shared solvent
+     * function cache.
+     *
+     * @param temp      Temperature kelvin
+     * @param pres      Pressure (pascal)
+     * @param ifunc     parameters specifying the desired information
+     *                 - 0 function value
+     *                 - 1 derivative wrt temperature
+     *                 - 2 2nd derivative wrt temperature
+     *                 - 3 derivative wrt pressure
+     */
+    doublereal relEpsilon(const doublereal temp, const doublereal pres,
+                          const int ifunc = 0) const;
+
+    //! Point #m_solventCache at the cache of the first HKFT species in the
+    //! phase, so that it is shared by all of the HKFT species.
+    void shareSolventCache();
+
     //! Function to look up Element Free Energies
     /*!
      * This function looks up the argument string in the element database and
@@ -327,6 +350,34 @@ private:
     //!  Pointer to the water property calculator
     std::unique_ptr<WaterProps> m_waterProps;
 
+    //! Values of the species-independent functions of T and P used by the
+    //! HKFT formulation, i.e. the g-function and the relative permittivity of
+    //! water and their derivatives, indexed by `ifunc`.
+    struct SolventCache {
+        SolventCache();
+
+        //! Discard the stored values if (temp, pres) differs from the state
+        //! at which they were evaluated.
+        void update(doublereal temp, doublereal pres);
+
+        doublereal m_temp;
+        doublereal m_pres;
+        doublereal m_gstar[4];
+        bool m_gstarOK[4];
+        doublereal m_relEps[4];
+        bool m_relEpsOK[4];
+
+        //! Density of water (kg/m^3) at (m_temp, m_pres), which is set when
+        //! any of the g-function values is evaluated
+        doublereal m_densWater;
+    };
+
+    //! Cache of the solvent functions. All of the PDSS_HKFT objects in a
+    //! phase share the same cache (see shareSolventCache()), so that the
+    //! water equation of state is solved once per (T, P) rather than once
+    //! per species and property.
+    shared_ptr<SolventCache> m_solventCache;
+
     //! Born coefficient for the current ion or species
     doublereal m_born_coeff_j;
 
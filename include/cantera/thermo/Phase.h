@@ -15,6 +15,99 @@
 namespace Cantera
 {
 
+class Phase;
+
+//! A saved thermodynamic state of a Phase object.
+/*!
+ * A StateSnapshot holds the temperature, density and mass fractions of a
+ * phase in a contiguous array laid out in the same way as the state vectors
+ * used by Phase::saveState(vector_fp&), i.e. `[T, rho, Y_0, ..., Y_{K-1}]`.
+ * In addition, it stores the mean molecular weight, the scaled mole
+ * fractions and the state number of the phase at the time the snapshot was
+ * taken. Storage is allocated on the first call to Phase::saveState(), so
+ * repeatedly saving and restoring the state of the same phase does not
+ * allocate memory.
+ *
+ * Restoring a snapshot into the phase from which it was taken uses a fast
+ * path which copies the stored composition directly and restores the state
+ * number of the phase, so that properties cached against that state number
+ * (see ValueCache) remain valid. If the phase has not been modified since the
+ * snapshot was taken, restoring it is a no-op.
+ *
+ * @ingroup phases
+ */
+class StateSnapshot
+{
+public:
+    StateSnapshot() :
+        m_mmw(0.0),
+        m_stateNum(-1),
+        m_owner(0)
+    {
+    }
+
+    //! Allocate storage for a phase with *nsp* species.
+    void resize(size_t nsp) {
+        m_data.resize(nsp + 2);
+        m_ym.resize(nsp);
+        m_owner = 0;
+    }
+
+    //! Number of species stored in the snapshot
+    size_t nSpecies() const {
+        return m_ym.size();
+    }
+
+    //! Length of the state array, equal to nSpecies() + 2
+    size_t size() const {
+        return m_data.size();
+    }
+
+    //! Element *n* of the state array `[T, rho, Y_0, ..., Y_{K-1}]`
+    doublereal operator[](size_t n) const {
+        return m_data[n];
+    }
+
+    //! Pointer to the state array `[T, rho, Y_0, ..., Y_{K-1}]`
+    const doublereal* data() const {
+        return m_data.data();
+    }
+
+    //! Temperature (K) of the saved state
+    doublereal temperature() const {
+        return m_data[0];
+    }
+
+    //! Density (kg/m^3) of the saved state
+    doublereal density() const {
+        return m_data[1];
+    }
+
+    //! Mass fractions of the saved state
+    const doublereal* massFractions() const {
+        return m_data.data() + 2;
+    }
+
+private:
+    friend class Phase;
+
+    //! Temperature, density and mass fractions. Length nSpecies() + 2.
+    vector_fp m_data;
+
+    //! Mole fractions divided by the mean molecular weight. Length nSpecies().
+    vector_fp m_ym;
+
+    //! Mean molecular weight (kg/kmol)
+    doublereal m_mmw;
+
+    //! Value of Phase::stateMFNumber() when the snapshot was taken
+    int m_stateNum;
+
+    //! The phase from which the snapshot was taken, or NULL if the snapshot
+    //! does not hold a valid state.
+    const Phase* m_owner;
+};
+
 /**
  * @defgroup phases Models of Phases of Matter
  *
@@ -100,12 +193,23 @@ public:
     Phase(const Phase& right);
     Phase& operator=(const Phase& right);
 
-    //! Returns a const reference to the XML_Node that describes the phase.
+    //! Returns a reference to the XML_Node that describes the phase.
     /*!
      *  The XML_Node for the phase contains all of the input data used to set up
-     *  the model for the phase during its initialization.
+     *  the model for the phase during its initialization. Copies of a phase
+     *  share the same XML tree, which must not be modified through this
+     *  reference. Use modifiableXml() to make changes.
+     */
+    const XML_Node& xml() const;
+
+    //! Returns a modifiable reference to the XML_Node that describes the
+    //! phase.
+    /*!
+     *  If the XML tree is shared with copies of this phase, this phase first
+     *  gets its own copy of the tree, so that changes made through the
+     *  returned reference are not seen by other phases.
      */
-    XML_Node& xml() const;
+    XML_Node& modifiableXml();
 
     //! Stores the XML tree information for the current phase
     /*!
@@ -116,7 +220,7 @@ public:
      *
      *  @param xmlPhase Reference to the XML node corresponding to the phase
      */
-    void setXMLdata(XML_Node& xmlPhase);
+    void setXMLdata(const XML_Node& xmlPhase);
 
     /*! @name Name and ID
      * Class Phase contains two strings that identify a phase. The ID is the
@@ -292,6 +396,39 @@ public:
     //!     @param state      Vector of state conditions.
     void restoreState(size_t lenstate, const doublereal* state);
 
+    //! Save the current internal state of the phase into a StateSnapshot.
+    //! Storage in *state* is only (re)allocated if it was not already sized
+    //! for this phase.
+    void saveState(StateSnapshot& state) const;
+
+    //! Restore a state saved on a previous call to saveState(StateSnapshot&).
+    /*!
+     * If *state* was taken from this phase, the composition is copied
+     * directly and the state number is reset to its value at the time the
+     * snapshot was taken, so values cached against that state remain valid.
+     * If the phase is still in the saved state, nothing is done. If species
+     * were added to the phase after the snapshot was taken, an
+     * ArraySizeError is thrown.
+     *     @param state  Snapshot containing the previously saved state.
+     */
+    void restoreState(const StateSnapshot& state);
+
+    //! Set the temperature, density and composition of this phase to those
+    //! of another phase with the same species.
+    /*!
+     * Unlike saving and restoring the state through the mass fractions, the
+     * internal composition of *other* is copied exactly, so that properties
+     * evaluated for the two phases are identical. This is intended for
+     * keeping copies of a phase created from the same phase definition in
+     * sync. Derived classes where the density is not the only independent
+     * variable besides the temperature and composition override this method
+     * to copy the remaining variables as well.
+     *     @param other  Phase whose state is copied. Must have the same
+     *                   species, with the same molecular weights, as this
+     *                   phase.
+     */
+    virtual void copyStateFrom(const Phase& other);
+
     /*! @name Set thermodynamic state
      * Set the internal thermodynamic state by setting the internally stored
      * temperature, density and species composition. Note that the composition
@@ -779,6 +916,11 @@ protected:
     //! should call the parent class method as well.
     virtual void compositionChanged();
 
+    //! Set the composition of this phase to that of another phase with the
+    //! same species, copying the internal composition exactly. Used by
+    //! copyStateFrom().
+    void copyCompositionFrom(const Phase& other);
+
     size_t m_kk; //!< Number of species in the phase.
 
     //! Dimensionality of the phase. Volumetric phases have dimensionality 3
@@ -803,7 +945,12 @@ protected:
     UndefElement::behavior m_undefinedElementBehavior;
 
 private:
-    XML_Node* m_xml; //!< XML node containing the XML info for this phase
+    //! XML node containing the XML info for this phase
+    XML_Node* m_xml;
+
+    //! Root of the XML tree containing #m_xml. The tree is shared between
+    //! copies of the phase until modifiableXml() is called on one of them.
+    shared_ptr<XML_Node> m_xmlRoot;
 
     //! ID of the phase. This is the value of the ID attribute of the XML
     //! phase node. The field will stay that way even if the name is changed.
@@ -839,9 +986,14 @@ private:
     vector_fp m_rmolwts; //!< inverse of species molecular weights (kmol kg-1)
 
     //! State Change variable. Whenever the mole fraction vector changes,
-    //! this int is incremented.
+    //! this int is set to a new value which has not been used before by this
+    //! phase. Restoring a StateSnapshot sets it back to the value it had when
+    //! the snapshot was taken.
     int m_stateNum;
 
+    //! Largest value assigned to #m_stateNum so far
+    int m_stateNumMax;
+
     //! Vector of the species names
     std::vector<std::string> m_speciesNames;
 
@@ -856,6 +1008,10 @@ private:
 
     //! Entropy at 298.15 K and 1 bar of stable state pure elements (J kmol-1)
     vector_fp m_entropy298;
+
+    //! Work array used to set the composition from a compositionMap. Length
+    //! m_kk.
+    vector_fp m_compWork;
 };
 
 }
@@ -135,7 +135,7 @@ std::string eosTypeString(int ieos, int length = 100);
  *
  * @ingroup inputfiles
  */
-ThermoPhase* newPhase(XML_Node& phase);
+ThermoPhase* newPhase(const XML_Node& phase);
 
 //! Create and Initialize a ThermoPhase object from an XML input file.
 /*!
@@ -203,7 +203,7 @@ ThermoPhase* newPhase(const std::string& infile, std::string id="");
  *              part of the Cantera Kernel.
  * @ingroup thermoprops
  */
-void importPhase(XML_Node& phase, ThermoPhase* th);
+void importPhase(const XML_Node& phase, ThermoPhase* th);
 
 //! Add the elements given in an XML_Node tree to the specified phase
 void installElements(Phase& th, const XML_Node& phaseNode);
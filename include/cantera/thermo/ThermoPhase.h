@@ -831,6 +831,15 @@ public:
         throw NotImplementedError("ThermoPhase::setPressure");
     }
 
+    //! Set the temperature, pressure, density and composition of this phase
+    //! to those of another phase with the same species.
+    /*!
+     * In addition to the variables copied by Phase::copyStateFrom(), the
+     * pressure is copied if *other* is a ThermoPhase, so that phases which
+     * store the pressure separately from the density are kept in sync.
+     */
+    virtual void copyStateFrom(const Phase& other);
+
     //! Set the temperature (K), pressure (Pa), and mole fractions.
     /*!
      * Note, the mole fractions are set first before the pressure is set.
@@ -1695,10 +1704,14 @@ protected:
     /*!
      * This is used to access data needed to construct the transport manager and
      * other properties later in the initialization process. We create a copy of
-     * the XML_Node data read in here. Therefore, we own this data.
+     * the XML_Node data read in here, which is owned by #m_speciesDataNodes.
      */
     std::vector<const XML_Node*> m_speciesData;
 
+    //! Owners of the XML nodes in #m_speciesData. The nodes are not modified
+    //! after they are added, so they are shared between copies of the phase.
+    std::vector<shared_ptr<XML_Node> > m_speciesDataNodes;
+
     //! Stored value of the electric potential for this phase. Units are Volts.
     doublereal m_phi;
 
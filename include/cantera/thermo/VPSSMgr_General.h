@@ -26,7 +26,14 @@ namespace Cantera
  *   This class manages the calculation of standard state thermo properties
  *   for a set of species belonging to a single phase in a completely general
  *   but slow way. The way this does this is to call the underlying PDSS
- *   routines one at a time for every species.
+ *   routines for every species.
+ *
+ *   The species are evaluated in groups of the same PDSS type. Species using
+ *   PDSS_ConstVol or PDSS_SSVol store their properties in the arrays of this
+ *   object when their state is set, so they are evaluated with a single call
+ *   each and their properties are copied from those arrays. Species using
+ *   PDSS_HKFT are evaluated one after the other, so that the solvent
+ *   properties they share (see PDSS_HKFT) are evaluated once for each state.
  *
  * @ingroup mgrpdssthermocalc
  */
@@ -128,9 +135,27 @@ public:
     virtual void initAllPtrs(VPStandardStateTP* vp_ptr, MultiSpeciesThermo* sp_ptr);
 
 private:
+    //! Sort the species into #m_arraySpecies, #m_hkftSpecies and
+    //! #m_otherSpecies according to the type of their PDSS objects
+    void groupSpecies();
+
     //! Shallow pointers containing the PDSS objects for the species
     //! in this phase. This object doesn't own these pointers.
     std::vector<PDSS*> m_PDSS_ptrs;
+
+    //! Species whose PDSS objects store their properties in the mPDSS_*
+    //! arrays of this object
+    std::vector<size_t> m_arraySpecies;
+
+    //! Species using PDSS_HKFT
+    std::vector<size_t> m_hkftSpecies;
+
+    //! All other species, whose properties are obtained from the PDSS objects
+    std::vector<size_t> m_otherSpecies;
+
+    //! Temperature and pressure at which _updateRefStateThermo() evaluated the
+    //! species in #m_arraySpecies, until the next _updateStandardStateThermo()
+    mutable doublereal m_arrayTemp, m_arrayPres;
 };
 
 }
@@ -135,6 +135,14 @@ public:
      */
     virtual void setState_TP(doublereal T, doublereal pres);
 
+    //! Copy the temperature, pressure and composition of another phase.
+    /*!
+     * The density of these phases is not updated when only the composition
+     * changes, so it is copied from *other* rather than recomputed, to make
+     * the state of the two phases identical.
+     */
+    virtual void copyStateFrom(const Phase& other);
+
     //! Returns the current pressure of the phase
     /*!
      *  The pressure is an independent variable in this phase. Its current value
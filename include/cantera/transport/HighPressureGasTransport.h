@@ -49,6 +49,10 @@ public:
         return "HighPressureGas";
     }
 
+    //! Initialize the transport object, and compute the critical constants of
+    //! each pure species, which are used by the corresponding states models.
+    virtual void init(thermo_t* thermo, int mode=0, int log_level=0);
+
     //! Return the thermal diffusion coefficients (kg/m/s)
     /*!
      *  Currently not implemented for this model
@@ -73,19 +77,48 @@ public:
     friend class TransportFactory;
 
 protected:
+    //! @name Pure species critical constants
+    //! These are called once for each species by init() to fill #m_Tcrit,
+    //! #m_Pcrit, #m_Vcrit and #m_Zcrit, which are used in all later
+    //! calculations. Derived classes may override them to supply other
+    //! critical constants. The default implementations set the composition
+    //! of the phase to pure species *i* and do not restore it.
+    //! @{
+
+    //! Critical temperature [K] of pure species *i*
     virtual doublereal Tcrit_i(size_t i);
 
+    //! Critical pressure [Pa] of pure species *i*
     virtual doublereal Pcrit_i(size_t i);
 
+    //! Critical molar volume [m^3/kmol] of pure species *i*
     virtual doublereal Vcrit_i(size_t i);
 
+    //! Critical compressibility of pure species *i*
     virtual doublereal Zcrit_i(size_t i);
+    //! @}
 
-    vector_fp store(size_t i, size_t nsp);
+    //! Set the composition of the phase to pure species *i*
+    void setPureSpecies(size_t i);
 
     virtual doublereal FQ_i(doublereal Q, doublereal Tr, doublereal MW);
 
     virtual doublereal setPcorr(doublereal Pr, doublereal Tr);
+
+    //! Critical temperatures [K] of the pure species. These, and the other
+    //! critical constants, are evaluated once by init() using Tcrit_i() etc.,
+    //! since evaluating them requires the composition of the phase to be
+    //! changed.
+    vector_fp m_Tcrit;
+
+    //! Critical pressures [Pa] of the pure species
+    vector_fp m_Pcrit;
+
+    //! Critical molar volumes [m^3/kmol] of the pure species
+    vector_fp m_Vcrit;
+
+    //! Critical compressibilities of the pure species
+    vector_fp m_Zcrit;
 };
 }
 #endif
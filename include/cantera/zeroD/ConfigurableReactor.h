@@ -0,0 +1,206 @@
+//! @file ConfigurableReactor.h
+
+#ifndef CT_CONFIGURABLEREACTOR_H
+#define CT_CONFIGURABLEREACTOR_H
+
+#include "cantera/numerics/FuncEval.h"
+#include "cantera/numerics/Integrator.h"
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+class ThermoPhase;
+class Kinetics;
+class Func1;
+
+//! A single homogeneous reactor whose governing equations are assembled from
+//! a small set of predefined building blocks.
+/*!
+ * This class is intended for custom reactor models that would otherwise be
+ * written as a user-defined right hand side in Python, where each evaluation
+ * requires many calls to the thermodynamic and kinetic property getters.
+ * Instead, the model is described by choosing:
+ *
+ * - the volume law: constant pressure, constant volume, or a volume which is
+ *   a prescribed function of time, \f$ V(t) \f$;
+ * - whether the energy equation is solved, or the temperature is held fixed;
+ * - a heat loss rate \f$ \dot Q(t) \f$ [W] to the surroundings;
+ * - additional volumetric source terms \f$ \dot s_k(t) \f$ [kmol/m^3/s] for
+ *   individual species, which add mass to the reactor at the current
+ *   temperature of its contents.
+ *
+ * The state vector is the mass of the reactor contents, their temperature,
+ * and the species mass fractions. The equations for these variables are
+ * \f[
+ *     \frac{dm}{dt} = V \sum_k \dot s_k W_k
+ * \f]
+ * \f[
+ *     m \frac{dY_k}{dt} = V (\dot\omega_k + \dot s_k) W_k - Y_k \frac{dm}{dt}
+ * \f]
+ * and, at constant pressure,
+ * \f[
+ *     m c_p \frac{dT}{dt} = - \dot Q - V \sum_k \hat h_k \dot\omega_k
+ * \f]
+ * or, with a constant or prescribed volume,
+ * \f[
+ *     m c_v \frac{dT}{dt} = - P \frac{dV}{dt} - \dot Q
+ *         - V \sum_k \hat u_k \dot\omega_k
+ *         + V \sum_k (\hat h_k - \hat u_k) \dot s_k
+ * \f]
+ *
+ * The equations are integrated entirely in C++ by a CVODES integrator owned
+ * by this object. Functions of time are evaluated through Func1 objects, so no
+ * callbacks are needed unless one of these is itself defined in Python.
+ */
+class ConfigurableReactor : public FuncEval
+{
+public:
+    //! Volume laws supported by ConfigurableReactor
+    enum VolumeLaw {
+        ConstantPressure,
+        ConstantVolume,
+        PrescribedVolume
+    };
+
+    //! Constructor
+    /*!
+     * @param thermo  Phase defining the contents of the reactor. Its state at
+     *     the time the reactor is initialized is used as the initial state.
+     * @param kin  Kinetics manager for the homogeneous reactions of *thermo*,
+     *     or null if there are no reactions.
+     */
+    ConfigurableReactor(ThermoPhase& thermo, Kinetics* kin=0);
+    virtual ~ConfigurableReactor();
+
+    //! @name Methods to set up the model
+    //@{
+
+    //! Hold the pressure fixed at its initial value
+    void setConstantPressure();
+
+    //! Hold the volume fixed at *V* [m^3]
+    void setConstantVolume(double V);
+
+    //! Use the volume *V*(t) [m^3], with the rate of change *dVdt*(t)
+    //! [m^3/s]. Both functions are used by reference and must outlive this
+    //! object.
+    void setVolumeFunction(Func1* V, Func1* dVdt);
+
+    //! The current volume law
+    VolumeLaw volumeLaw() const {
+        return m_volumeLaw;
+    }
+
+    //! Set the volume [m^3] used with the constant pressure law. Defaults to
+    //! 1 m^3.
+    void setInitialVolume(double V);
+
+    //! Enable or disable the energy equation. If disabled, the temperature
+    //! is held fixed.
+    void setEnergy(bool energy) {
+        m_energy = energy;
+        m_init = false;
+    }
+
+    bool energyEnabled() const {
+        return m_energy;
+    }
+
+    //! Set the rate of heat loss [W] from the reactor as a function of time
+    void setHeatLoss(Func1* Q) {
+        m_heatLoss = Q;
+    }
+
+    //! Add a volumetric source [kmol/m^3/s] of species *k* as a function of
+    //! time. Replaces any source previously set for the same species.
+    void setSpeciesSource(size_t k, Func1* s);
+
+    //! Remove all species sources
+    void clearSpeciesSources();
+
+    //! Set the relative and absolute tolerances for the integrator
+    void setTolerances(double rtol, double atol);
+
+    //! Set the maximum time step [s] allowed by the integrator. Zero means
+    //! no limit.
+    void setMaxTimeStep(double maxstep);
+
+    //! Set the initial time [s]. The next call to advance() restarts the
+    //! integration from the current state of the phase at this time.
+    void setInitialTime(double t);
+    //@}
+
+    //! Initialize the state vector from the current state of the phase and
+    //! the integrator
+    void initialize(double t0=0.0);
+
+    //! Advance the state of the reactor to time *t* [s]. On return, the
+    //! phase is set to the state of the reactor at time *t*.
+    void advance(double t);
+
+    //! The current time [s]
+    double time() const {
+        return m_time;
+    }
+
+    //! The mass of the reactor contents [kg]
+    double mass() const {
+        return m_mass;
+    }
+
+    //! The volume of the reactor [m^3]
+    double volume() const {
+        return m_volume;
+    }
+
+    //! @name Implementation of FuncEval
+    //@{
+    virtual void eval(double t, double* y, double* ydot, double* p);
+    virtual void getState(double* y);
+    virtual size_t neq() {
+        return m_nv;
+    }
+    //@}
+
+    //! Set the phase to the state described by the state vector *y* at time
+    //! *t*, and update the volume.
+    void updateState(double t, const double* y);
+
+protected:
+    ThermoPhase& m_thermo;
+    Kinetics* m_kin;
+
+    VolumeLaw m_volumeLaw;
+    Func1* m_volumeFunc;
+    Func1* m_volumeRate;
+    Func1* m_heatLoss;
+    bool m_energy;
+
+    //! Indices and rates of species with source terms
+    std::vector<size_t> m_sourceIndex;
+    std::vector<Func1*> m_sourceFunc;
+
+    //! Integrator used by advance(). Created by initialize().
+    std::unique_ptr<Integrator> m_integ;
+    double m_time;
+    bool m_init;
+    size_t m_nv;
+    double m_rtol;
+    double m_atol;
+    double m_maxstep;
+
+    double m_mass;
+    double m_volume;
+    double m_pressure;
+
+    //! Work arrays of length nSpecies()
+    vector_fp m_wdot;
+    vector_fp m_sdot;
+    vector_fp m_work;
+    vector_fp m_work2;
+};
+
+}
+
+#endif
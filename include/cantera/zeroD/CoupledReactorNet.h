@@ -0,0 +1,246 @@
+//! @file CoupledReactorNet.h
+
+#ifndef CT_COUPLEDREACTORNET_H
+#define CT_COUPLEDREACTORNET_H
+
+#include "cantera/base/ct_defs.h"
+
+#include <map>
+
+namespace Cantera
+{
+
+class ReactorNet;
+class ReactorBase;
+class Reservoir;
+
+//! Estimate of the relative cost of integrating a reactor.
+/*!
+ * Evaluating the finite difference Jacobian of a reactor with *nSpecies*
+ * species requires one evaluation of the governing equations for each of the
+ * approximately `nSpecies + 3` state variables, and the cost of each
+ * evaluation is dominated by the calculation of the *nReactions* reaction
+ * rates and the species source terms. Used as the weights for
+ * partitionReactorGraph().
+ */
+double reactorCost(size_t nSpecies, size_t nReactions);
+
+//! Partition the graph of a reactor network into sub-networks.
+/*!
+ * The nodes of the graph are the reactors, and the edges are the flow
+ * devices and walls which connect them. Each edge which connects two
+ * sub-networks requires the states of the connected reactors to be exchanged
+ * at every coupling step (see CoupledReactorNet), so the partitioning tries
+ * to minimize the number of such edges while keeping the total weight of
+ * each sub-network close to the average.
+ *
+ * The partitions are grown one at a time from a starting reactor by adding
+ * the adjacent reactor with the most connections to the partition, after
+ * which reactors on the boundaries between partitions are moved where this
+ * reduces the number of connecting edges without exceeding the allowed
+ * imbalance.
+ *
+ * @param weights  Relative cost of each reactor, e.g. from reactorCost()
+ * @param edges    Pairs of indices of connected reactors. Multiple edges
+ *                 between the same reactors count separately.
+ * @param nParts   Number of sub-networks
+ * @param imbalance  Allowed fractional excess of the weight of a
+ *                   sub-network over the average
+ * @returns the index of the sub-network of each reactor
+ */
+std::vector<size_t> partitionReactorGraph(
+    const vector_fp& weights,
+    const std::vector<std::pair<size_t, size_t> >& edges,
+    size_t nParts, double imbalance = 0.05);
+
+//! Connection used to exchange messages with another process.
+/*!
+ * Each message is an array of doubles. Messages are received in the order in
+ * which they were sent, and receive() blocks until a message is available.
+ */
+class CouplingChannel
+{
+public:
+    virtual ~CouplingChannel() {}
+
+    //! Send *n* values from the array *data*
+    virtual void send(const double* data, size_t n) = 0;
+
+    //! Receive the next message into *data*, which is resized to the length
+    //! of the message.
+    virtual void receive(vector_fp& data) = 0;
+};
+
+#ifndef _WIN32
+//! A CouplingChannel which uses a connected stream socket.
+/*!
+ * Channels between processes on the same machine can be created either
+ * before the processes are started, from the two ends of a `socketpair`, or
+ * by having one process call accept() and the other connect() with the
+ * same path for a Unix domain socket.
+ */
+class SocketChannel : public CouplingChannel
+{
+public:
+    //! Create a channel using the connected socket *fd*, which is closed when
+    //! the channel is destroyed.
+    explicit SocketChannel(int fd);
+    virtual ~SocketChannel();
+
+    //! Wait for a connection on the Unix domain socket *path*
+    static SocketChannel* accept(const std::string& path);
+
+    //! Connect to the Unix domain socket *path*, retrying for up to
+    //! *timeout* seconds while no process is listening at that path.
+    static SocketChannel* connect(const std::string& path,
+                                  double timeout = 10.0);
+
+    virtual void send(const double* data, size_t n);
+    virtual void receive(vector_fp& data);
+
+private:
+    SocketChannel(const SocketChannel&);
+    SocketChannel& operator=(const SocketChannel&);
+
+    int m_fd;
+};
+#endif
+
+//! A sub-network of a reactor network which is integrated together with
+//! other sub-networks, usually in separate processes.
+/*!
+ * Networks which are too large to be assembled in a single process can be
+ * divided into sub-networks, for example using partitionReactorGraph(). Each
+ * process then only creates the reactors of its own sub-network. A reactor
+ * of another sub-network which is connected to a local reactor by a flow
+ * device or a wall is represented by a Reservoir, the "ghost" of the remote
+ * reactor, whose contents are updated with the state of the remote reactor
+ * after each coupling step. The states of the local reactors which are
+ * represented by ghosts in other sub-networks are sent to those processes.
+ * Each exchanged state is identified by an integer tag, which must be the
+ * same in the sending and the receiving process.
+ *
+ * Mass and energy transfer between sub-networks are evaluated in the
+ * receiving process using the ghost states, so flow devices which connect
+ * sub-networks must be present on both sides, e.g. as an outlet to a ghost in
+ * one process and as an inlet from a ghost in the other process.
+ *
+ * The sub-networks are integrated over coupling intervals of fixed length.
+ * With the default Jacobi scheme, all sub-networks are integrated at the same
+ * time using the ghost states from the start of the interval. With the
+ * Gauss-Seidel scheme, each process first waits for the states at the end of
+ * the interval from its peers with lower rank. For flows directed from
+ * lower to higher ranks, the receiving sub-network then uses the current
+ * state of the upstream reactors, at the expense of integrating the
+ * sub-networks one after the other. Each interval can be integrated several
+ * times (see setCouplingIterations()), with the ghost states from the end of
+ * the previous iteration, which converges towards fully implicit coupling.
+ *
+ * All processes must use the same coupling interval, number of iterations
+ * and scheme, and must call advance() with the same sequence of times.
+ */
+class CoupledReactorNet
+{
+public:
+    //! Create a coupled sub-network for the reactor network *net*. *rank* is
+    //! a number which is unique for each sub-network and determines the order
+    //! of the communication between processes.
+    CoupledReactorNet(ReactorNet& net, int rank);
+
+    //! The network of local reactors
+    ReactorNet& network() {
+        return m_net;
+    }
+
+    //! Add a channel to the process handling the sub-network with rank
+    //! *rank*. Returns the index of the peer used by addExport() and
+    //! addImport().
+    size_t addPeer(CouplingChannel& channel, int rank);
+
+    //! Send the state of the local reactor *r* to peer *peer*, identified by
+    //! the tag *tag*.
+    void addExport(ReactorBase& r, size_t peer, int tag);
+
+    //! Set the state of *ghost* from the state with the tag *tag* received
+    //! from peer *peer*.
+    void addImport(Reservoir& ghost, size_t peer, int tag);
+
+    //! Set the length (s) of the coupling intervals
+    void setCouplingInterval(double dt);
+
+    //! Set the number of times each coupling interval is integrated
+    void setCouplingIterations(size_t n);
+
+    //! Use the Gauss-Seidel scheme instead of the Jacobi scheme
+    void setGaussSeidel(bool gs = true) {
+        m_gaussSeidel = gs;
+    }
+
+    //! Current time (s) of the sub-network
+    double time() const {
+        return m_time;
+    }
+
+    //! Advance all sub-networks to time *t*, which is rounded up to the end
+    //! of a coupling interval.
+    void advance(double t);
+
+    //! Largest change of a ghost state in the last iteration of the last
+    //! coupling interval. This is the largest relative change in temperature
+    //! or density, or absolute change in a mass fraction, and can be used to
+    //! judge whether more coupling iterations are needed.
+    double couplingResidual() const {
+        return m_residual;
+    }
+
+protected:
+    struct Peer
+    {
+        CouplingChannel* channel;
+        int rank;
+        //! Reactors whose states are sent to this peer, by tag
+        std::vector<std::pair<int, ReactorBase*> > exports;
+        //! Ghosts which are set from the states received from this peer,
+        //! by tag
+        std::map<int, Reservoir*> imports;
+    };
+
+    //! Send the states of the exported reactors to *peer*
+    void sendStates(Peer& peer);
+
+    //! Receive the states from *peer* and update the ghosts
+    void receiveStates(Peer& peer);
+
+    //! Exchange states with all peers, in an order which avoids deadlocks
+    //! between processes
+    void exchangeStates();
+
+    //! Integrate the local network over one coupling interval
+    void integrateInterval(double t1);
+
+    ReactorNet& m_net;
+    int m_rank;
+
+    std::vector<Peer> m_peers;
+
+    //! Indices of the peers, sorted by rank
+    std::vector<size_t> m_order;
+
+    double m_time;
+    double m_interval;
+    size_t m_iterations;
+    bool m_gaussSeidel;
+    bool m_init;
+    double m_residual;
+
+    //! State of the local network at the start of the current interval
+    vector_fp m_y0;
+
+    //! Work arrays for sending and receiving messages
+    vector_fp m_buf;
+    vector_fp m_state;
+};
+
+}
+
+#endif
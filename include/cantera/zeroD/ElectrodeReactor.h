@@ -0,0 +1,122 @@
+//! @file ElectrodeReactor.h
+
+#ifndef CT_ELECTRODEREACTOR_H
+#define CT_ELECTRODEREACTOR_H
+
+#include "Reactor.h"
+
+namespace Cantera
+{
+
+class InterfaceKinetics;
+
+/**
+ * A zero-dimensional model of an electrode particle, in which the electric
+ * potential of the electrode phase is a state variable.
+ *
+ * The contents of the reactor are the electron-conducting electrode phase,
+ * which is held at constant temperature, pressure and composition. Charge
+ * transfer reactions take place on the ReactorSurface objects installed on
+ * the reactor. The kinetics manager of each surface must be an
+ * InterfaceKinetics object with the electrode phase as its first phase. The
+ * other phases taking part in these reactions, such as the electrolyte, are
+ * held at the state set by the user.
+ *
+ * The potential of the electrode changes by charging the electric double
+ * layer at its surfaces:
+ * \f[
+ *     C_{dl} A \frac{d\phi}{dt} = I - I_F(\phi)
+ * \f]
+ * where \f$ I \f$ is the current supplied to the electrode by the external
+ * circuit, \f$ A \f$ is the total surface area, and \f$ I_F \f$ is the
+ * faradaic current, the rate at which positive charge leaves the electrode
+ * through the charge transfer reactions. The faradaic current and its
+ * derivative with respect to the potential are evaluated by
+ * InterfaceKinetics::currentDensity() and
+ * InterfaceKinetics::currentDensity_ddPhi(), which only visit the charge
+ * transfer reactions.
+ *
+ * The state vector is the electrode potential followed by the coverages of
+ * the species on each surface, which evolve as in class Reactor.
+ */
+class ElectrodeReactor : public Reactor
+{
+public:
+    ElectrodeReactor();
+
+    virtual int type() const {
+        return ElectrodeReactorType;
+    }
+
+    //! Set the current supplied to the electrode by the external circuit [A]
+    void setCurrent(double I) {
+        m_current = I;
+    }
+
+    //! Current supplied to the electrode by the external circuit [A]
+    double current() const {
+        return m_current;
+    }
+
+    //! Set the double layer capacitance per unit surface area [F/m^2]
+    void setDoubleLayerCapacitance(double C);
+
+    //! Double layer capacitance per unit surface area [F/m^2]
+    double doubleLayerCapacitance() const {
+        return m_capacitance;
+    }
+
+    //! Electric potential of the electrode phase [V]
+    double electricPotential() const {
+        return m_phi;
+    }
+
+    //! Total area of the surfaces installed on this reactor [m^2]
+    double surfaceArea() const;
+
+    //! Faradaic current [A] at the current state: the rate at which positive
+    //! charge is transferred from the electrode to the other phases by the
+    //! charge transfer reactions on all surfaces.
+    double faradaicCurrent();
+
+    //! Derivative of faradaicCurrent() with respect to the electric potential
+    //! of the electrode [A/V], evaluated analytically. Used to build the
+    //! Jacobian for Newton solves of the current-voltage relationship.
+    double faradaicCurrent_ddPhi();
+
+    virtual void getState(doublereal* y);
+
+    virtual void initialize(doublereal t0 = 0.0);
+
+    virtual void evalEqs(doublereal t, doublereal* y,
+                         doublereal* ydot, doublereal* params);
+
+    virtual void updateState(doublereal* y);
+
+    //! Not supported; the electrode phase has no homogeneous reactions
+    virtual void addSensitivityReaction(size_t rxn);
+
+    //! Return the index in the solution vector for this reactor of the
+    //! component named *nm*. Possible values for *nm* are "potential" or the
+    //! name of a surface species.
+    virtual size_t componentIndex(const std::string& nm) const;
+    virtual std::string componentName(size_t k);
+
+protected:
+    virtual size_t speciesIndex(const std::string& nm) const;
+
+    //! Set the electric potential and the surface coverages in the phase
+    //! objects to the values for this reactor
+    void syncPhases();
+
+    double m_current; //!< external current [A]
+    double m_capacitance; //!< double layer capacitance [F/m^2]
+    double m_phi; //!< electric potential of the electrode phase [V]
+
+    //! Kinetics managers of the surfaces, in the order of #m_surfaces
+    std::vector<InterfaceKinetics*> m_surfKin;
+};
+
+}
+
+#endif
@@ -21,6 +21,7 @@ const int FlowReactorType = 3;
 const int ConstPressureReactorType = 4;
 const int IdealGasReactorType = 5;
 const int IdealGasConstPressureReactorType = 6;
+const int ElectrodeReactorType = 7;
 
 enum class SensParameterType {
     reaction,
@@ -234,7 +235,11 @@ protected:
     doublereal m_enthalpy;
     doublereal m_intEnergy;
     doublereal m_pressure;
-    vector_fp m_state;
+
+    //! State of the reactor contents after the last call to updateState() or
+    //! syncState(). Restoring this snapshot into #m_thermo is a no-op if the
+    //! phase has not been modified since.
+    StateSnapshot m_state;
     std::vector<FlowDevice*> m_inlet, m_outlet;
     std::vector<Wall*> m_wall;
     std::vector<ReactorSurface*> m_surfaces;
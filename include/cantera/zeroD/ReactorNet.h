@@ -9,6 +9,7 @@
 #include "cantera/numerics/FuncEval.h"
 #include "cantera/numerics/Integrator.h"
 #include "cantera/base/Array.h"
+#include "cantera/base/WorkerThreads.h"
 
 namespace Cantera
 {
@@ -144,14 +145,41 @@ public:
 
     //! Evaluate the Jacobian matrix for the reactor network.
     /*!
+     *  If networks have been added with addJacobianWorker(), the integrator
+     *  uses this Jacobian instead of its internal finite difference
+     *  approximation.
+     *
      *  @param[in] t Time at which to evaluate the Jacobian
      *  @param[in] y Global state vector at time *t*
      *  @param[out] ydot Time derivative of the state vector evaluated at *t*.
      *  @param[in] p sensitivity parameter vector (unused?)
      *  @param[out] j Jacobian matrix, size neq() by neq().
      */
-    void evalJacobian(doublereal t, doublereal* y,
-                      doublereal* ydot, doublereal* p, Array2D* j);
+    virtual void evalJacobian(doublereal t, doublereal* y,
+                              doublereal* ydot, doublereal* p, Array2D* j);
+
+    //! Add a reactor network used to evaluate columns of the Jacobian in
+    //! evalJacobian() on an additional thread.
+    /*!
+     * Reactors, walls and flow devices cannot be copied automatically, so
+     * *net* must be set up in the same way as this network, using its own
+     * ThermoPhase and Kinetics objects, with any reservoirs in the same state
+     * as those of this network, and with the same sensitivity parameters.
+     * The Jacobian evaluated using the additional networks is then identical
+     * to the one evaluated by a single thread. Each time the Jacobian is
+     * evaluated, an exception is thrown if a network has a different number
+     * of state variables or different sensitivity parameters, or if its time
+     * derivative at the unperturbed state differs from that of this network.
+     *
+     * The threads are created the first time the Jacobian is evaluated and
+     * reused afterwards. The network is not owned by this object, and must
+     * not be used otherwise while this network is integrated. The integrator
+     * is reinitialized before the next integration step.
+     */
+    void addJacobianWorker(ReactorNet& net);
+
+    //! Remove all networks added with addJacobianWorker().
+    void clearJacobianWorkers();
 
     // overloaded methods of class FuncEval
     virtual size_t neq() {
@@ -213,6 +241,14 @@ protected:
     //! advance or step is called.
     void initialize();
 
+    //! Evaluate columns *c0* to *c1*-1 of the Jacobian using the reactors of
+    //! this network and the absolute and relative tolerances *atol* and
+    //! *rtol*. Other arguments are the same as for evalJacobian(), with
+    //! *ydot* being the unperturbed time derivative.
+    void evalJacColumns(doublereal t, doublereal* y, const doublereal* ydot,
+                        doublereal* p, Array2D* j, const doublereal* atol,
+                        doublereal rtol, size_t c0, size_t c1);
+
     std::vector<Reactor*> m_reactors;
     Integrator* m_integ;
     doublereal m_time;
@@ -237,6 +273,16 @@ protected:
     std::vector<std::string> m_paramNames;
 
     vector_fp m_ydot;
+
+    //! Networks used to evaluate Jacobian columns on additional threads
+    std::vector<ReactorNet*> m_jacWorkers;
+
+    //! Threads used to evaluate Jacobian columns with m_jacWorkers
+    std::unique_ptr<WorkerThreads> m_jacThreads;
+
+    //! Copy of the state vector perturbed by this network when it is used
+    //! to evaluate Jacobian columns for another network
+    vector_fp m_yJac;
 };
 }
 
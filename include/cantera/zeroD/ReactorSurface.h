@@ -62,6 +62,39 @@ public:
     //! surface.
     void syncCoverages();
 
+    //! Treat the surface coverages as algebraic variables which are in
+    //! pseudo-steady state with the adjacent phases.
+    /*!
+     * If enabled, the coverages are not part of the state vector of the
+     * reactor. Instead, they are found with
+     * InterfaceKinetics::solvePseudoSteadyStateProblem() each time the
+     * governing equations are evaluated, starting from the coverages found in
+     * the previous evaluation. This removes the fast surface time scales from
+     * the ODE system. The kinetics manager must be an InterfaceKinetics
+     * object. Changing this setting after the reactor network has been
+     * initialized requires the network to be reinitialized.
+     */
+    void setPseudoSteadyState(bool pss=true) {
+        m_pseudoSteadyState = pss;
+    }
+
+    //! True if the coverages are solved for as being in pseudo-steady state.
+    //! See setPseudoSteadyState().
+    bool pseudoSteadyState() const {
+        return m_pseudoSteadyState;
+    }
+
+    //! Number of variables contributed by this surface to the state vector of
+    //! the reactor: the number of surface species, or zero if the coverages
+    //! are in pseudo-steady state.
+    size_t neq() const;
+
+    //! Solve for the pseudo-steady state coverages at the current state of
+    //! the adjacent phases, starting from the current coverages, and store
+    //! them as the coverages of this surface. The states of the phases other
+    //! than the surface phase are left unchanged.
+    void solvePseudoSteadyState();
+
     //! Enable calculation of sensitivities with respect to the rate constant
     //! for reaction `i`.
     void addSensitivityReaction(size_t i);
@@ -84,6 +117,14 @@ protected:
     ReactorBase* m_reactor;
     vector_fp m_cov;
     std::vector<SensitivityParameter> m_params;
+
+    //! True if the coverages are in pseudo-steady state
+    bool m_pseudoSteadyState;
+
+    //! Saved states of the phases adjacent to the surface. Restoring a phase
+    //! that the solver did not modify is a no-op and leaves its state number
+    //! unchanged.
+    std::vector<StateSnapshot> m_phaseStates;
 };
 
 }
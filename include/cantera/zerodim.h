@@ -9,5 +9,8 @@
 #include "zeroD/ConstPressureReactor.h"
 #include "zeroD/IdealGasReactor.h"
 #include "zeroD/IdealGasConstPressureReactor.h"
+#include "zeroD/ElectrodeReactor.h"
+#include "zeroD/ConfigurableReactor.h"
+#include "zeroD/CoupledReactorNet.h"
 
 #endif
@@ -108,7 +108,7 @@ cdef extern from "cantera/thermo/ThermoPhase.h" namespace "Cantera":
         double maxTemp() except +
         double refPressure() except +
         cbool getElementPotentials(double*) except +
-        void equilibrate(string, string, double, int, int, int, int) except +
+        void equilibrate(string, string, double, int, int, int, int) except + nogil
         void saveState(size_t, double*)
         void restoreState(size_t, double*)
 
@@ -355,6 +355,13 @@ cdef extern from "cantera/kinetics/Kinetics.h" namespace "Cantera":
         void skipUndeclaredThirdBodies(cbool)
         void addReaction(shared_ptr[CxxReaction]) except +
         void modifyReaction(int, shared_ptr[CxxReaction]) except +
+        void removeReaction(size_t) except +
+        void beginEdit() except +
+        void commitEdit() except +
+        cbool editing()
+        void setArrheniusParameters(size_t, double, double, double) except +
+        void setArrheniusParameters(double*, double*, double*) except +
+        void getArrheniusParameters(double*, double*, double*) except +
         void invalidateCache() except +
 
         shared_ptr[CxxReaction] reaction(size_t) except +
@@ -369,10 +376,12 @@ cdef extern from "cantera/kinetics/Kinetics.h" namespace "Cantera":
         double multiplier(int)
         void setMultiplier(int, double)
 
+        void updateRatesOfProgress() except +
+
 
 cdef extern from "cantera/kinetics/InterfaceKinetics.h":
     cdef cppclass CxxInterfaceKinetics "Cantera::InterfaceKinetics":
-        void advanceCoverages(double) except +
+        void advanceCoverages(double) except + nogil
 
 
 cdef extern from "cantera/transport/TransportBase.h" namespace "Cantera":
@@ -419,7 +428,7 @@ cdef extern from "cantera/equil/MultiPhase.h" namespace "Cantera":
         void init() except +
         void updatePhases() except +
 
-        void equilibrate(string, string, double, int, int, int, int) except +
+        void equilibrate(string, string, double, int, int, int, int) except + nogil
 
         size_t nSpecies()
         size_t nElements()
@@ -497,6 +506,19 @@ cdef extern from "cantera/zeroD/FlowReactor.h":
         double distance()
 
 
+cdef extern from "cantera/zeroD/ElectrodeReactor.h":
+    cdef cppclass CxxElectrodeReactor "Cantera::ElectrodeReactor" (CxxReactor):
+        CxxElectrodeReactor()
+        void setCurrent(double)
+        double current()
+        void setDoubleLayerCapacitance(double) except +
+        double doubleLayerCapacitance()
+        double electricPotential()
+        double surfaceArea()
+        double faradaicCurrent() except +
+        double faradaicCurrent_ddPhi() except +
+
+
 cdef extern from "cantera/zeroD/Wall.h":
     cdef cppclass CxxWall "Cantera::Wall":
         CxxWall()
@@ -532,6 +554,8 @@ cdef extern from "cantera/zeroD/ReactorSurface.h":
         void setCoverages(double*)
         void setCoverages(Composition&) except +
         void syncCoverages()
+        void setPseudoSteadyState(cbool)
+        cbool pseudoSteadyState()
         void addSensitivityReaction(size_t) except +
         size_t nSensParams()
 
@@ -560,8 +584,8 @@ cdef extern from "cantera/zeroD/ReactorNet.h":
     cdef cppclass CxxReactorNet "Cantera::ReactorNet":
         CxxReactorNet()
         void addReactor(CxxReactor&)
-        void advance(double) except +
-        double step(double) except +
+        void advance(double) except + nogil
+        double step(double) except + nogil
         void reinitialize() except +
         double time()
         void setInitialTime(double)
@@ -584,6 +608,27 @@ cdef extern from "cantera/zeroD/ReactorNet.h":
         size_t nparams()
         string sensitivityParameterName(size_t) except +
 
+cdef extern from "cantera/zeroD/ConfigurableReactor.h":
+    cdef cppclass CxxConfigurableReactor "Cantera::ConfigurableReactor":
+        CxxConfigurableReactor(CxxThermoPhase&, CxxKinetics*) except +
+        void setConstantPressure()
+        void setConstantVolume(double) except +
+        void setVolumeFunction(CxxFunc1*, CxxFunc1*) except +
+        void setInitialVolume(double) except +
+        void setEnergy(cbool)
+        cbool energyEnabled()
+        void setHeatLoss(CxxFunc1*)
+        void setSpeciesSource(size_t, CxxFunc1*) except +
+        void clearSpeciesSources()
+        void setTolerances(double, double)
+        void setMaxTimeStep(double)
+        void setInitialTime(double)
+        void advance(double) except + nogil
+        double time()
+        double mass()
+        double volume()
+        size_t neq()
+
 
 cdef extern from "cantera/thermo/ThermoFactory.h" namespace "Cantera":
     cdef CxxThermoPhase* newPhase(string, string) except +
@@ -701,8 +746,8 @@ cdef extern from "cantera/oneD/Sim1D.h":
         void setMaxTimeStepCount(int)
         int maxTimeStepCount()
         void getInitialSoln() except +
-        void solve(int, cbool) except +translate_exception
-        void refine(int) except +
+        void solve(int, cbool) except +translate_exception nogil
+        void refine(int) except + nogil
         void setRefineCriteria(size_t, double, double, double, double) except +
         void save(string, string, string, int) except +
         void restore(string, string, int) except +
@@ -864,6 +909,8 @@ cdef class _SolutionBase:
     cdef CxxTransport* transport
     cdef int thermo_basis
     cdef np.ndarray _selected_species
+    cdef np.ndarray _species_work
+    cdef tuple _rop_buffers
     cdef object parent
     cdef cbool is_slice
 
@@ -872,7 +919,7 @@ cdef class ThermoPhase(_SolutionBase):
     cdef double _mole_factor(self)
     cpdef int element_index(self, element) except *
     cpdef int species_index(self, species) except *
-    cdef np.ndarray _getArray1(self, thermoMethod1d method)
+    cdef np.ndarray _getArray1(self, thermoMethod1d method, np.ndarray out=*)
     cdef void _setArray1(self, thermoMethod1d method, values) except *
     cdef public object _references
 
@@ -942,6 +989,9 @@ cdef class IdealGasConstPressureReactor(Reactor):
 cdef class FlowReactor(Reactor):
     pass
 
+cdef class ElectrodeReactor(Reactor):
+    pass
+
 cdef class ReactorSurface:
     cdef CxxReactorSurface* surface
     cdef Kinetics _kinetics
@@ -982,6 +1032,11 @@ cdef class ReactorNet:
     cdef CxxReactorNet net
     cdef list _reactors
 
+cdef class ConfigurableReactor:
+    cdef CxxConfigurableReactor* model
+    cdef _SolutionBase _contents
+    cdef dict _funcs
+
 cdef class Domain1D:
     cdef CxxDomain1D* domain
     cdef _SolutionBase gas
@@ -1039,10 +1094,15 @@ cdef class ReactionPathDiagram:
 # free functions
 cdef string stringify(x) except *
 cdef pystr(string x)
-cdef np.ndarray get_species_array(Kinetics kin, kineticsMethod1d method)
-cdef np.ndarray get_reaction_array(Kinetics kin, kineticsMethod1d method)
-cdef np.ndarray get_transport_1d(Transport tran, transportMethod1d method)
-cdef np.ndarray get_transport_2d(Transport tran, transportMethod2d method)
+cdef np.ndarray output_array(np.ndarray out, size_t n)
+cdef np.ndarray get_species_array(Kinetics kin, kineticsMethod1d method,
+                                  np.ndarray out=*)
+cdef np.ndarray get_reaction_array(Kinetics kin, kineticsMethod1d method,
+                                   np.ndarray out=*)
+cdef np.ndarray get_transport_1d(Transport tran, transportMethod1d method,
+                                 np.ndarray out=*)
+cdef np.ndarray get_transport_2d(Transport tran, transportMethod2d method,
+                                 np.ndarray out=*)
 cdef CxxIdealGasPhase* getIdealGasPhase(ThermoPhase phase) except *
 cdef wrapSpeciesThermo(shared_ptr[CxxSpeciesThermo] spthermo)
 cdef Reaction wrapReaction(shared_ptr[CxxReaction] reaction)
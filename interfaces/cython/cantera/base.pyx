@@ -135,3 +135,13 @@ cdef class _SolutionBase:
             del self.thermo
             del self.kinetics
             del self.transport
+
+
+cdef np.ndarray species_work_array(_SolutionBase obj, size_t n):
+    """
+    Return a scratch array of *n* doubles owned by *obj*, used to hold the
+    values for all species before the selected species are extracted.
+    """
+    if obj._species_work is None or obj._species_work.shape[0] != n:
+        obj._species_work = np.empty(n)
+    return obj._species_work
@@ -56,6 +56,12 @@ class Solution(ThermoPhase, Kinetics, Transport):
                       options=['skip_undeclared_elements', 'skip_undeclared_species', 'skip_undeclared_third_bodies'],
                       initial_state=state(temperature=300, pressure=101325))'''
         gas = ct.Solution(source=cti_def)
+
+    Long-running methods such as `equilibrate` release the Python global
+    interpreter lock, so independent `Solution` objects can be used from
+    different Python threads at the same time. A single `Solution` object, and
+    the objects which hold a reference to it, such as reactors, must not be
+    used from several threads at once.
     """
     __slots__ = ()
 
@@ -75,6 +81,9 @@ class Interface(InterfacePhase, InterfaceKinetics):
         gas = ct.Solution('diamond.cti', 'gas')
         diamond = ct.Solution('diamond.cti', 'diamond')
         diamond_surf = ct.Interface('diamond.cti', 'diamond_100', [gas, diamond])
+
+    As for `Solution`, an `Interface` and its adjacent phases must not be used
+    from several Python threads at once.
     """
     __slots__ = ('_phase_indices',)
 
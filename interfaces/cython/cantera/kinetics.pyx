@@ -1,20 +1,79 @@
 # NOTE: These cdef functions cannot be members of Kinetics because they would
 # cause "layout conflicts" when creating derived classes with multiple bases,
 # e.g. class Solution. [Cython 0.16]
-cdef np.ndarray get_species_array(Kinetics kin, kineticsMethod1d method):
-    cdef np.ndarray[np.double_t, ndim=1] data = np.empty(kin.n_total_species)
-    method(kin.kinetics, &data[0])
+cdef np.ndarray get_species_array(Kinetics kin, kineticsMethod1d method,
+                                  np.ndarray out=None):
+    cdef np.ndarray[np.double_t, ndim=1] data
     # @TODO: Fix _selected_species to work with interface kinetics
     if kin._selected_species.size:
-        return data[kin._selected_species]
-    else:
-        return data
+        data = species_work_array(kin, kin.n_total_species)
+        method(kin.kinetics, &data[0])
+        if out is None:
+            return data[kin._selected_species]
+        out = output_array(out, len(kin._selected_species))
+        return np.take(data, kin._selected_species, out=out)
+    data = output_array(out, kin.n_total_species)
+    method(kin.kinetics, &data[0])
+    return data
 
-cdef np.ndarray get_reaction_array(Kinetics kin, kineticsMethod1d method):
-    cdef np.ndarray[np.double_t, ndim=1] data = np.empty(kin.n_reactions)
+cdef np.ndarray get_reaction_array(Kinetics kin, kineticsMethod1d method,
+                                   np.ndarray out=None):
+    cdef np.ndarray[np.double_t, ndim=1] data
+    data = output_array(out, kin.n_reactions)
     method(kin.kinetics, &data[0])
     return data
 
+cdef tuple rates_of_progress_buffers(Kinetics kin):
+    """
+    Return the arrays owned by *kin* which hold the forward, reverse and net
+    rates of progress for `Kinetics.rates_of_progress_views`. New arrays are
+    created when the number of reactions changes.
+    """
+    cdef size_t n = kin.n_reactions
+    if kin._rop_buffers is None or kin._rop_buffers[0].shape[0] != n:
+        kin._rop_buffers = (np.zeros(n), np.zeros(n), np.zeros(n))
+    return kin._rop_buffers
+
+
+cdef class _KineticsArrayGetter:
+    """
+    The C++ getter for one of the array properties of Kinetics, which has one
+    value for each species or one value for each reaction.
+    """
+    cdef kineticsMethod1d method
+    cdef cbool species
+
+cdef _KineticsArrayGetter _kinetics_array_getter(kineticsMethod1d method,
+                                                 cbool species=False):
+    cdef _KineticsArrayGetter getter = _KineticsArrayGetter()
+    getter.method = method
+    getter.species = species
+    return getter
+
+# Getters used by Kinetics.get_kinetics_array, looked up by property name
+_kinetics_array_getters = {
+    'forward_rates_of_progress':
+        _kinetics_array_getter(kin_getFwdRatesOfProgress),
+    'reverse_rates_of_progress':
+        _kinetics_array_getter(kin_getRevRatesOfProgress),
+    'net_rates_of_progress':
+        _kinetics_array_getter(kin_getNetRatesOfProgress),
+    'equilibrium_constants':
+        _kinetics_array_getter(kin_getEquilibriumConstants),
+    'forward_rate_constants': _kinetics_array_getter(kin_getFwdRateConstants),
+    'reverse_rate_constants': _kinetics_array_getter(kin_getRevRateConstants),
+    'creation_rates': _kinetics_array_getter(kin_getCreationRates, True),
+    'destruction_rates': _kinetics_array_getter(kin_getDestructionRates, True),
+    'net_production_rates':
+        _kinetics_array_getter(kin_getNetProductionRates, True),
+    'delta_enthalpy': _kinetics_array_getter(kin_getDeltaEnthalpy),
+    'delta_gibbs': _kinetics_array_getter(kin_getDeltaGibbs),
+    'delta_entropy': _kinetics_array_getter(kin_getDeltaEntropy),
+    'delta_standard_enthalpy': _kinetics_array_getter(kin_getDeltaSSEnthalpy),
+    'delta_standard_gibbs': _kinetics_array_getter(kin_getDeltaSSGibbs),
+    'delta_standard_entropy': _kinetics_array_getter(kin_getDeltaSSEntropy),
+}
+
 
 cdef class Kinetics(_SolutionBase):
     """
@@ -101,6 +160,37 @@ cdef class Kinetics(_SolutionBase):
         """ Add a new reaction to this phase. """
         self.kinetics.addReaction(rxn._reaction)
 
+    def remove_reaction(self, int irxn):
+        """
+        Remove the reaction with index ``irxn``. The indices of the following
+        reactions are reduced by one. To remove several reactions, call
+        `begin_edit` first.
+        """
+        self._check_reaction_index(irxn)
+        self.kinetics.removeReaction(irxn)
+
+    def begin_edit(self):
+        """
+        Begin a set of changes to the reaction mechanism. Reactions added with
+        `add_reaction` or removed with `remove_reaction` are only processed
+        when `commit_edit` is called, which avoids rebuilding the internal
+        data structures after each change. Reaction rates may not be evaluated
+        until then.
+        """
+        self.kinetics.beginEdit()
+
+    def commit_edit(self):
+        """
+        Finish the set of changes to the reaction mechanism started by
+        `begin_edit`.
+        """
+        self.kinetics.commitEdit()
+
+    property editing:
+        """ True if an edit started by `begin_edit` is in progress. """
+        def __get__(self):
+            return self.kinetics.editing()
+
     def is_reversible(self, int i_reaction):
         """True if reaction `i_reaction` is reversible."""
         self._check_reaction_index(i_reaction)
@@ -128,6 +218,45 @@ cdef class Kinetics(_SolutionBase):
             self._check_reaction_index(i_reaction)
             self.kinetics.setMultiplier(i_reaction, value)
 
+    def set_arrhenius_parameters(self, A, b, Ea, i_reaction=None):
+        """
+        Change the Arrhenius parameters of reaction *i_reaction* in place,
+        without replacing the reaction. The activation energy *Ea* is in
+        J/kmol. If *i_reaction* is not specified, *A*, *b*, and *Ea* are arrays
+        of length `n_reactions`; entries which are NaN, and entries for
+        reactions without an Arrhenius rate expression, are ignored. For
+        falloff reactions, the high-pressure limit is changed. The `Reaction`
+        objects returned by `reaction` are not updated. See
+        `get_arrhenius_parameters`.
+        """
+        cdef np.ndarray[np.double_t, ndim=1] cA, cb, cE
+        if i_reaction is None:
+            cA = np.ascontiguousarray(A, dtype=np.double)
+            cb = np.ascontiguousarray(b, dtype=np.double)
+            cE = np.ascontiguousarray(Ea, dtype=np.double) / gas_constant
+            for v in (cA, cb, cE):
+                if len(v) != self.n_reactions:
+                    raise ValueError('Arrays must have length n_reactions')
+            self.kinetics.setArrheniusParameters(&cA[0], &cb[0], &cE[0])
+        else:
+            self._check_reaction_index(i_reaction)
+            self.kinetics.setArrheniusParameters(<size_t>i_reaction, A, b,
+                                                 Ea / gas_constant)
+
+    def get_arrhenius_parameters(self):
+        """
+        Get the pre-exponential factors, temperature exponents, and activation
+        energies [J/kmol] of all reactions, as a tuple of three arrays. Entries
+        for reactions without an Arrhenius rate expression are NaN. See
+        `set_arrhenius_parameters`.
+        """
+        cdef np.ndarray[np.double_t, ndim=1] A = np.empty(self.n_reactions)
+        cdef np.ndarray[np.double_t, ndim=1] b = np.empty(self.n_reactions)
+        cdef np.ndarray[np.double_t, ndim=1] E = np.empty(self.n_reactions)
+        if self.n_reactions:
+            self.kinetics.getArrheniusParameters(&A[0], &b[0], &E[0])
+        return A, b, E * gas_constant
+
     def reaction_type(self, int i_reaction):
         """Type of reaction *i_reaction*."""
         self._check_reaction_index(i_reaction)
@@ -332,6 +461,55 @@ cdef class Kinetics(_SolutionBase):
         def __get__(self):
             return get_reaction_array(self, kin_getDeltaSSEntropy)
 
+    def get_kinetics_array(self, name, np.ndarray out not None):
+        """
+        Write the values of the array-valued property *name* into the
+        existing array *out* and return it. For example,
+        ``kin.get_kinetics_array('net_production_rates', wdot)`` has the same
+        result as ``wdot[:] = kin.net_production_rates``, but does not
+        allocate a new array. *out* must be a writable, contiguous array of
+        doubles of the same length as the property.
+        """
+        cdef _KineticsArrayGetter getter = _kinetics_array_getters.get(name)
+        if getter is None:
+            raise ValueError("'{}' is not an array-valued property of class "
+                             "Kinetics".format(name))
+        if getter.species:
+            return get_species_array(self, getter.method, out)
+        return get_reaction_array(self, getter.method, out)
+
+    def update_rates_of_progress(self):
+        """
+        Write the rates of progress for the current state into the arrays
+        returned by `rates_of_progress_views`, without allocating new arrays.
+        """
+        if self.kinetics.editing():
+            raise RuntimeError("Rates of progress are not available "
+                               "while an edit is in progress")
+        fwd, rev, net = rates_of_progress_buffers(self)
+        self.kinetics.updateRatesOfProgress()
+        get_reaction_array(self, kin_getFwdRatesOfProgress, fwd)
+        get_reaction_array(self, kin_getRevRatesOfProgress, rev)
+        get_reaction_array(self, kin_getNetRatesOfProgress, net)
+
+    property rates_of_progress_views:
+        """
+        Read-only views of arrays owned by this object which hold the forward,
+        reverse and net rates of progress. The values are computed for the
+        current state when the views are created, and updated in place by
+        `update_rates_of_progress`. After the number of reactions changes,
+        `update_rates_of_progress` writes to new arrays, and views created
+        earlier keep their previous values.
+        """
+        def __get__(self):
+            self.update_rates_of_progress()
+            views = []
+            for buf in rates_of_progress_buffers(self):
+                view = buf.view()
+                view.flags.writeable = False
+                views.append(view)
+            return tuple(views)
+
 
 cdef class InterfaceKinetics(Kinetics):
     """
@@ -355,7 +533,9 @@ cdef class InterfaceKinetics(Kinetics):
         This method carries out a time-accurate advancement of the surface
         coverages for a specified amount of time.
         """
-        (<CxxInterfaceKinetics*>self.kinetics).advanceCoverages(dt)
+        cdef CxxInterfaceKinetics* kin = <CxxInterfaceKinetics*>self.kinetics
+        with nogil:
+            kin.advanceCoverages(dt)
 
     def phase_index(self, phase):
         """
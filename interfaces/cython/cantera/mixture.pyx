@@ -280,8 +280,9 @@ cdef class Mixture:
             self.mix.getChemPotentials(&data[0])
             return data
 
-    def equilibrate(self, XY, solver='auto', rtol=1e-9, max_steps=1000,
-                    max_iter=100, estimate_equil=0, log_level=0):
+    def equilibrate(self, XY, solver='auto', double rtol=1e-9,
+                    int max_steps=1000, int max_iter=100,
+                    int estimate_equil=0, int log_level=0):
         """
         Set to a state of chemical equilibrium holding property pair *XY*
         constant. This method uses a version of the VCS algorithm to find the
@@ -322,5 +323,8 @@ cdef class Mixture:
             process. 0 indicates no output, while larger numbers produce
             successively more verbose information.
         """
-        self.mix.equilibrate(stringify(XY.upper()), stringify(solver), rtol,
-                             max_steps, max_iter, estimate_equil, log_level)
+        cdef string cxy = stringify(XY.upper())
+        cdef string csolver = stringify(solver)
+        with nogil:
+            self.mix.equilibrate(cxy, csolver, rtol, max_steps, max_iter,
+                                 estimate_equil, log_level)
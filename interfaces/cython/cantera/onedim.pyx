@@ -518,6 +518,12 @@ cdef class AxisymmetricStagnationFlow(_FlowBase):
         self.flow = <CxxStFlow*>(new CxxAxiStagnFlow(gas, thermo.n_species, 2))
 
 
+cdef void _sim1d_solve(CxxSim1D* sim, int loglevel, cbool refine) except *:
+    # The GIL is released while solving, and reacquired for any callbacks
+    with nogil:
+        sim.solve(loglevel, refine)
+
+
 cdef class Sim1D:
     """
     Class Sim1D is a container for one-dimensional domains. It also holds the
@@ -525,6 +531,10 @@ cdef class Sim1D:
     solution.
 
     Domains are ordered left-to-right, with domain number 0 at the left.
+
+    `solve` and `refine` release the Python global interpreter lock. A `Sim1D`
+    object and the `Solution` objects used by its domains must not be used
+    from another Python thread while a solution is being computed.
     """
     def __cinit__(self, *args, **kwargs):
         self.sim = NULL
@@ -801,7 +811,7 @@ cdef class Sim1D:
         if not auto:
             if not self._initialized:
                 self.set_initial_guess()
-            self.sim.solve(loglevel, <cbool>refine_grid)
+            _sim1d_solve(self.sim, loglevel, refine_grid)
             return
 
         have_user_tolerances = any(dom.have_user_tolerances for dom in self.domains)
@@ -845,7 +855,7 @@ cdef class Sim1D:
                 # Try solving with energy enabled, which usually works
                 log('Solving on {} point grid with energy equation enabled', N)
                 self.energy_enabled = True
-                self.sim.solve(loglevel, <cbool>False)
+                _sim1d_solve(self.sim, loglevel, False)
                 solved = True
             except Exception as e:
                 log(str(e))
@@ -858,10 +868,10 @@ cdef class Sim1D:
                 log('Initial solve failed; Retrying with energy equation disabled')
                 try:
                     self.energy_enabled = False
-                    self.sim.solve(loglevel, <cbool>False)
+                    _sim1d_solve(self.sim, loglevel, False)
                     log('Solving on {} point grid with energy equation re-enabled', N)
                     self.energy_enabled = True
-                    self.sim.solve(loglevel, <cbool>False)
+                    _sim1d_solve(self.sim, loglevel, False)
                     solved = True
                 except Exception as e:
                     log(str(e))
@@ -870,7 +880,7 @@ cdef class Sim1D:
                 # Found a non-extinct solution on the fixed grid
                 log('Solving with grid refinement enabled')
                 try:
-                    self.sim.solve(loglevel, <cbool>True)
+                    _sim1d_solve(self.sim, loglevel, True)
                     solved = True
                 except Exception as e:
                     log(str(e))
@@ -903,7 +913,7 @@ cdef class Sim1D:
 
         # Final call with expensive options enabled
         if have_user_tolerances or solve_multi:
-            self.sim.solve(loglevel, <cbool>True)
+            _sim1d_solve(self.sim, loglevel, True)
 
 
     def refine(self, loglevel=1):
@@ -911,7 +921,9 @@ cdef class Sim1D:
         Refine the grid, adding points where solution is not adequately
         resolved.
         """
-        self.sim.refine(loglevel)
+        cdef int lvl = loglevel
+        with nogil:
+            self.sim.refine(lvl)
 
     def set_refine_criteria(self, domain, ratio=10.0, slope=0.8, curve=0.8,
                           prune=0.05):
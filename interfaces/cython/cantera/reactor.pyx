@@ -368,6 +368,52 @@ cdef class FlowReactor(Reactor):
             return (<CxxFlowReactor*>self.reactor).distance()
 
 
+cdef class ElectrodeReactor(Reactor):
+    """
+    A zero-dimensional model of an electrode particle. The contents are the
+    electron-conducting electrode phase, which is held at constant
+    temperature, pressure and composition, and its electric potential is
+    integrated in time. Charge transfer reactions take place on the
+    `ReactorSurface` objects installed on the reactor, whose kinetics
+    managers must have the electrode phase as their first phase. The
+    potential changes by charging the electric double layer with the
+    difference between the applied current and the faradaic current.
+    """
+    reactor_type = "ElectrodeReactor"
+
+    property current:
+        """ Current [A] supplied to the electrode by the external circuit """
+        def __get__(self):
+            return (<CxxElectrodeReactor*>self.reactor).current()
+        def __set__(self, double I):
+            (<CxxElectrodeReactor*>self.reactor).setCurrent(I)
+
+    property double_layer_capacitance:
+        """ Double layer capacitance per unit surface area [F/m^2] """
+        def __get__(self):
+            return (<CxxElectrodeReactor*>self.reactor).doubleLayerCapacitance()
+        def __set__(self, double C):
+            (<CxxElectrodeReactor*>self.reactor).setDoubleLayerCapacitance(C)
+
+    property electric_potential:
+        """ Electric potential [V] of the electrode """
+        def __get__(self):
+            return (<CxxElectrodeReactor*>self.reactor).electricPotential()
+
+    property surface_area:
+        """ Total area [m^2] of the surfaces installed on the reactor """
+        def __get__(self):
+            return (<CxxElectrodeReactor*>self.reactor).surfaceArea()
+
+    property faradaic_current:
+        """
+        Rate [A] at which positive charge leaves the electrode through the
+        charge transfer reactions at the current state
+        """
+        def __get__(self):
+            return (<CxxElectrodeReactor*>self.reactor).faradaicCurrent()
+
+
 cdef class WallSurface:
     """
     Represents a wall surface in contact with the contents of a reactor.
@@ -488,6 +534,18 @@ cdef class ReactorSurface:
                     np.ascontiguousarray(coverages, dtype=np.double)
             self.surface.setCoverages(&data[0])
 
+    property pseudo_steady_state:
+        """
+        If `True`, the coverages are not integrated in time, but are solved
+        for as being in pseudo-steady state with the reactor contents each
+        time the governing equations are evaluated. Must be set before the
+        reactor network is initialized.
+        """
+        def __get__(self):
+            return self.surface.pseudoSteadyState()
+        def __set__(self, pss):
+            self.surface.setPseudoSteadyState(pss)
+
     def add_sensitivity_reaction(self, int m):
         """
         Specifies that the sensitivity of the state variables with respect to
@@ -902,6 +960,12 @@ cdef class ReactorNet:
 
     >>> reactor_network = ReactorNet([r1, r2])
     >>> reactor_network.advance(time)
+
+    `advance` and `step` release the Python global interpreter lock, so
+    networks which share no reactors or `Solution` objects can be integrated
+    in different Python threads at the same time. A network, or any of the
+    `Solution` objects used by its reactors, must not be used from another
+    thread while it is being integrated.
     """
     def __init__(self, reactors=()):
         self._reactors = []  # prevents premature garbage collection
@@ -918,7 +982,8 @@ cdef class ReactorNet:
         Advance the state of the reactor network in time from the current
         time to time *t* [s], taking as many integrator timesteps as necessary.
         """
-        self.net.advance(t)
+        with nogil:
+            self.net.advance(t)
 
     def step(self, double t=-999):
         """
@@ -929,7 +994,10 @@ cdef class ReactorNet:
             The argument *t* is deprecated and will be removed after
             Cantera 2.3.
         """
-        return self.net.step(t)
+        cdef double tnew
+        with nogil:
+            tnew = self.net.step(t)
+        return tnew
 
     def reinitialize(self):
         """
@@ -1184,3 +1252,176 @@ cdef class ReactorNet:
 
     def __copy__(self):
         raise NotImplementedError('ReactorNet object is not copyable')
+
+
+cdef class ConfigurableReactor:
+    """
+    A single homogeneous reactor whose governing equations are assembled in
+    C++ from a fixed set of building blocks: a volume law (constant pressure,
+    constant volume, or a prescribed volume as a function of time), an
+    optional energy equation, a heat loss rate, and volumetric species source
+    terms. The equations are integrated entirely in C++, which avoids the
+    overhead of evaluating a user-defined right hand side in Python.
+
+    The state of *contents* when the integration starts is used as the initial
+    state, and *contents* is set to the state of the reactor after each call
+    to `advance`.
+
+    >>> gas = Solution('gri30.xml')
+    >>> r = ConfigurableReactor(gas, volume_law='constant-volume', volume=0.1,
+    ...                         heat_loss=lambda t: 50.0)
+    >>> r.advance(1e-3)
+    """
+    def __cinit__(self, _SolutionBase contents, *args, **kwargs):
+        self.model = new CxxConfigurableReactor(deref(contents.thermo),
+                                                contents.kinetics)
+
+    def __init__(self, _SolutionBase contents, *,
+                 volume_law='constant-pressure', volume=None, energy='on',
+                 heat_loss=None):
+        """
+        :param contents:
+            `Solution` defining the contents of the reactor. Its kinetics
+            manager, if any, is used for the homogeneous reactions.
+        :param volume_law:
+            One of ``'constant-pressure'`` or ``'constant-volume'``. To use a
+            prescribed volume, call `set_volume_function`.
+        :param volume:
+            Initial volume [m^3]. Defaults to 1 m^3.
+        :param energy:
+            Set to ``'on'`` or ``'off'``. If set to ``'off'``, the energy
+            equation is not solved, and the temperature is held at its
+            initial value.
+        :param heat_loss:
+            Rate of heat loss [W]. May be either a constant or an arbitrary
+            function of time. See `Func1`.
+        """
+        self._contents = contents
+        self._funcs = {}
+        if volume is not None:
+            self.model.setInitialVolume(volume)
+        if volume_law == 'constant-volume':
+            self.model.setConstantVolume(self.model.volume())
+        elif volume_law != 'constant-pressure':
+            raise ValueError("'volume_law' must be either 'constant-pressure'"
+                             " or 'constant-volume'")
+        if energy == 'off':
+            self.model.setEnergy(False)
+        elif energy != 'on':
+            raise ValueError("'energy' must be either 'on' or 'off'")
+        if heat_loss is not None:
+            self.set_heat_loss(heat_loss)
+
+    def __dealloc__(self):
+        del self.model
+
+    def set_constant_pressure(self):
+        """ Hold the pressure fixed at its initial value. """
+        self.model.setConstantPressure()
+
+    def set_constant_volume(self, double V):
+        """ Hold the volume fixed at *V* [m^3]. """
+        self.model.setConstantVolume(V)
+
+    def set_volume_function(self, V, dVdt):
+        """
+        Prescribe the volume *V* [m^3] and its rate of change *dVdt* [m^3/s]
+        as functions of time. See `Func1`.
+        """
+        cdef Func1 f = V if isinstance(V, Func1) else Func1(V)
+        cdef Func1 g = dVdt if isinstance(dVdt, Func1) else Func1(dVdt)
+        self._funcs['volume'] = (f, g)
+        self.model.setVolumeFunction(f.func, g.func)
+
+    property energy_enabled:
+        """
+        *True* when the energy equation is being solved for this reactor.
+        When this is *False*, the reactor temperature is held constant.
+        """
+        def __get__(self):
+            return self.model.energyEnabled()
+
+        def __set__(self, pybool value):
+            self.model.setEnergy(value)
+
+    def set_heat_loss(self, Q):
+        """
+        Rate of heat loss [W] from the reactor. May be either a constant or an
+        arbitrary function of time. See `Func1`.
+        """
+        cdef Func1 f = Q if isinstance(Q, Func1) else Func1(Q)
+        self._funcs['heat_loss'] = f
+        self.model.setHeatLoss(f.func)
+
+    def set_species_source(self, species, s):
+        """
+        Volumetric source [kmol/m^3/s] of *species*, given by name or index.
+        May be either a constant or an arbitrary function of time. See
+        `Func1`. The added species enter at the temperature of the reactor.
+        """
+        cdef int k = self._contents.species_index(species)
+        cdef Func1 f = s if isinstance(s, Func1) else Func1(s)
+        self._funcs['source', k] = f
+        self.model.setSpeciesSource(k, f.func)
+
+    def clear_species_sources(self):
+        """ Remove all species source terms. """
+        self.model.clearSpeciesSources()
+        for key in list(self._funcs):
+            if isinstance(key, tuple):
+                del self._funcs[key]
+
+    def set_tolerances(self, double rtol=-1, double atol=-1):
+        """
+        Set the relative and absolute error tolerances used by the integrator.
+        Negative values leave the corresponding tolerance unchanged.
+        """
+        self.model.setTolerances(rtol, atol)
+
+    def set_max_time_step(self, double t):
+        """
+        Set the maximum time step *t* [s] that the integrator is allowed
+        to use.
+        """
+        self.model.setMaxTimeStep(t)
+
+    def set_initial_time(self, double t):
+        """
+        Set the initial time. Restarts integration from this time using the
+        current state of the contents as the initial condition.
+        """
+        self.model.setInitialTime(t)
+
+    def advance(self, double t):
+        """
+        Advance the state of the reactor in time from the current time to
+        time *t* [s].
+        """
+        with nogil:
+            self.model.advance(t)
+
+    property time:
+        """The current time [s]."""
+        def __get__(self):
+            return self.model.time()
+
+    property mass:
+        """The mass of the reactor contents [kg]."""
+        def __get__(self):
+            return self.model.mass()
+
+    property volume:
+        """The volume of the reactor [m^3]."""
+        def __get__(self):
+            return self.model.volume()
+
+    property n_vars:
+        """The number of state variables in the reactor equations."""
+        def __get__(self):
+            return self.model.neq()
+
+    def __reduce__(self):
+        raise NotImplementedError('ConfigurableReactor object is not picklable')
+
+    def __copy__(self):
+        raise NotImplementedError('ConfigurableReactor object is not copyable')
@@ -2,6 +2,7 @@ from __future__ import division
 
 import unittest
 import os
+import threading
 import warnings
 
 import numpy as np
@@ -133,6 +134,31 @@ class VCS_EquilTest(EquilTestCases, utilities.CanteraTest):
         unittest.TestCase.__init__(self, *args, **kwargs)
 
 
+class ThreadedEquilTest(utilities.CanteraTest):
+    # equilibrate() releases the GIL, so independent Solution objects can be
+    # equilibrated from concurrent threads
+    def solve(self, T0, results, i):
+        gas = ct.Solution('gri30.xml')
+        gas.TPX = T0, ct.one_atm, 'CH4:1.0, O2:1.5, N2:5.64'
+        gas.equilibrate('HP')
+        results[i] = gas.T
+
+    def test_threads(self):
+        T0 = [300 + 50 * i for i in range(4)]
+        serial = [None] * len(T0)
+        threaded = [None] * len(T0)
+        for i, T in enumerate(T0):
+            self.solve(T, serial, i)
+
+        threads = [threading.Thread(target=self.solve, args=(T, threaded, i))
+                   for i, T in enumerate(T0)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertArrayNear(serial, threaded)
+
+
 class TestKOH_Equil(utilities.CanteraTest):
     "Test roughly based on examples/multiphase/plasma_equilibrium.py"
     @classmethod
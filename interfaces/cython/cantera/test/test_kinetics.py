@@ -117,6 +117,34 @@ class TestKinetics(utilities.CanteraTest):
         self.assertArrayNear(self.phase.forward_rates_of_progress - self.phase.reverse_rates_of_progress,
                              self.phase.net_rates_of_progress)
 
+    def test_get_kinetics_array(self):
+        wdot = np.empty(self.phase.n_species)
+        out = self.phase.get_kinetics_array('net_production_rates', wdot)
+        self.assertIs(out, wdot)
+        self.assertArrayNear(wdot, self.phase.net_production_rates)
+
+        kf = np.empty(self.phase.n_reactions)
+        self.phase.get_kinetics_array('forward_rate_constants', kf)
+        self.assertArrayNear(kf, self.phase.forward_rate_constants)
+
+        with self.assertRaises(ValueError):
+            self.phase.get_kinetics_array('net_production_rates', np.empty(3))
+        with self.assertRaises(ValueError):
+            self.phase.get_kinetics_array('foo', kf)
+
+    def test_rates_of_progress_views(self):
+        fwd, rev, net = self.phase.rates_of_progress_views
+        self.assertFalse(net.flags.writeable)
+        self.phase.update_rates_of_progress()
+        self.assertArrayNear(fwd, self.phase.forward_rates_of_progress)
+        self.assertArrayNear(net, self.phase.net_rates_of_progress)
+
+        # views are updated in place after a change of state
+        self.phase.TP = self.phase.T + 100, None
+        self.phase.update_rates_of_progress()
+        self.assertArrayNear(rev, self.phase.reverse_rates_of_progress)
+        self.assertArrayNear(net, self.phase.net_rates_of_progress)
+
     def test_rate_constants(self):
         self.assertEqual(len(self.phase.forward_rate_constants), self.phase.n_reactions)
         self.assertArrayNear(self.phase.forward_rate_constants / self.phase.reverse_rate_constants,
@@ -251,6 +279,120 @@ class KineticsFromReactions(utilities.CanteraTest):
         self.assertArrayNear(gas1.net_production_rates,
                              gas2.net_production_rates)
 
+    def test_rates_of_progress_views_add_reaction(self):
+        S = ct.Species.listFromFile('h2o2.xml')
+        R = ct.Reaction.listFromFile('h2o2.xml')
+        gas = ct.Solution(thermo='IdealGas', kinetics='GasKinetics',
+                          species=S, reactions=R[:5])
+        gas.TPY = 800, 2*ct.one_atm, 'H2:0.3, O2:0.7, OH:2e-4, O:1e-3, H:5e-5'
+        fwd, rev, net = gas.rates_of_progress_views
+        net0 = net.copy()
+
+        # views created before the reactions were added keep their values
+        for r in R[5:]:
+            gas.add_reaction(r)
+        gas.update_rates_of_progress()
+        self.assertEqual(len(net), 5)
+        self.assertArrayNear(net, net0)
+
+        fwd, rev, net = gas.rates_of_progress_views
+        self.assertEqual(len(net), gas.n_reactions)
+        self.assertArrayNear(net, gas.net_rates_of_progress)
+
+    def test_bulk_edit(self):
+        gas1 = ct.Solution('h2o2.xml')
+
+        S = ct.Species.listFromFile('h2o2.xml')
+        R = ct.Reaction.listFromFile('h2o2.xml')
+        gas2 = ct.Solution(thermo='IdealGas', kinetics='GasKinetics',
+                           species=S, reactions=R[:5])
+
+        gas1.TPY = 800, 2*ct.one_atm, 'H2:0.3, O2:0.7, OH:2e-4, O:1e-3, H:5e-5'
+        gas2.TPY = gas1.TPY
+
+        gas2.begin_edit()
+        self.assertTrue(gas2.editing)
+        for r in R[5:]:
+            gas2.add_reaction(r)
+        gas2.remove_reaction(0)
+        gas2.commit_edit()
+        self.assertFalse(gas2.editing)
+
+        self.assertEqual(gas1.n_reactions - 1, gas2.n_reactions)
+        self.assertArrayNear(gas1.forward_rate_constants[1:],
+                             gas2.forward_rate_constants)
+        gas1.set_multiplier(0.0, 0)
+        self.assertArrayNear(gas1.net_production_rates,
+                             gas2.net_production_rates)
+
+        gas2.remove_reaction(0)
+        self.assertEqual(gas1.n_reactions - 2, gas2.n_reactions)
+        self.assertArrayNear(gas1.net_rates_of_progress[2:],
+                             gas2.net_rates_of_progress)
+
+
+    def test_bulk_edit_invalid_reaction(self):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 800, 2*ct.one_atm, 'H2:0.3, O2:0.7, OH:2e-4, O:1e-3'
+        kf = gas.forward_rate_constants
+        n = gas.n_reactions
+
+        gas.begin_edit()
+        gas.add_reaction(gas.reaction(0))
+        R = ct.ThreeBodyReaction({'O':2}, {'O2':1})
+        R.rate = ct.Arrhenius(1.2e11, -1.0, 0.0)
+        R.efficiencies = {'H2': 2.4, 'CO2': 3.8}
+        gas.add_reaction(R)
+
+        # rates are not available while editing
+        with self.assertRaises(Exception):
+            gas.forward_rate_constants
+        with self.assertRaises(Exception):
+            gas.net_production_rates
+        with self.assertRaises(Exception):
+            gas.rates_of_progress_views
+
+        # the failed commit leaves the mechanism unchanged
+        with self.assertRaises(Exception):
+            gas.commit_edit()
+        self.assertTrue(gas.editing)
+        self.assertEqual(gas.n_reactions, n + 2)
+
+        gas.remove_reaction(n + 1)
+        gas.commit_edit()
+        self.assertArrayNear(gas.forward_rate_constants[:n], kf)
+        self.assertNear(gas.forward_rate_constants[n], kf[0])
+
+    def test_set_arrhenius_parameters(self):
+        gas1 = ct.Solution('h2o2.xml')
+        gas2 = ct.Solution('h2o2.xml')
+        gas1.TPX = gas2.TPX = 900, 2*ct.one_atm, 'H2:0.3, O2:0.7, OH:2e-4'
+
+        A, b, Ea = gas2.get_arrhenius_parameters()
+        R = gas1.reaction(2)
+        self.assertNear(A[2], R.rate.pre_exponential_factor)
+        self.assertNear(Ea[2], R.rate.activation_energy)
+
+        # Scale rates other than falloff reactions, where the factor applies
+        # only to the high-pressure limit
+        scaled = np.array([gas1.reaction_type(i) in (1, 2)
+                           for i in range(gas1.n_reactions)])
+        scaled[:3] = False
+        A[scaled] *= 2
+        Ea[:3] = np.nan
+        gas2.set_arrhenius_parameters(A, b, Ea)
+        gas2.set_arrhenius_parameters(3 * A[2], b[2] + 0.5, 0.0, 2)
+        kf1 = gas1.forward_rate_constants
+        kf2 = gas2.forward_rate_constants
+        self.assertArrayNear(kf1[:2], kf2[:2])
+        self.assertNear(3 * kf1[2] * 900**0.5 *
+                        np.exp(R.rate.activation_energy / (ct.gas_constant * 900)),
+                        kf2[2])
+        self.assertArrayNear(2 * kf1[scaled], kf2[scaled])
+        self.assertArrayNear(kf1[3:][~scaled[3:]], kf2[3:][~scaled[3:]])
+
+        with self.assertRaises(ValueError):
+            gas2.set_arrhenius_parameters(A[1:], b, Ea)
 
 class KineticsRepeatability(utilities.CanteraTest):
     """
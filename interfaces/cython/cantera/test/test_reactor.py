@@ -865,6 +865,130 @@ class TestFlowReactor(utilities.CanteraTest):
             self.assertNear(r.speed, v, 1e-3)
 
 
+class TestElectrodeReactor(utilities.CanteraTest):
+    def setUp(self):
+        mech = 'sofc-test.xml'
+        gas, self.metal, oxide = ct.import_phases(mech,
+                                                  ['gas', 'metal', 'oxide_bulk'])
+        msurf = ct.Interface(mech, 'metal_surface', [gas])
+        osurf = ct.Interface(mech, 'oxide_surface', [gas, oxide])
+        self.tpb = ct.Interface(mech, 'tpb', [self.metal, msurf, osurf])
+        msurf.X = "(m):0.3 H(m):0.3 O(m):0.4"
+        osurf.X = "(ox):0.2 O''(ox):0.5 OH'(ox):0.3"
+        self.metal.electric_potential = 0.2
+        osurf.electric_potential = -0.1
+
+        self.r = ct.ElectrodeReactor(self.metal)
+        self.surf = ct.ReactorSurface(self.tpb, self.r, A=2e-3)
+        self.r.double_layer_capacitance = 0.5
+        self.net = ct.ReactorNet([self.r])
+
+    def test_charging(self):
+        r = self.r
+        CA = r.double_layer_capacitance * r.surface_area
+        I_F = r.faradaic_current
+        r.current = I_F + 1e-3 * r.surface_area
+        self.assertNear(r.electric_potential, 0.2)
+
+        # At first, the double layer is charged by the difference between the
+        # applied and the faradaic current
+        dt = 1e-4
+        self.net.advance(dt)
+        self.assertNear((r.electric_potential - 0.2) / dt,
+                        (r.current - I_F) / CA, 1e-3)
+
+    def test_steady_state(self):
+        r = self.r
+        r.current = r.faradaic_current + 1e-3 * r.surface_area
+        self.net.advance_to_steady_state()
+        self.assertNear(r.faradaic_current, r.current, 1e-5)
+        self.assertGreater(r.electric_potential, 0.2)
+
+
+class TestConfigurableReactor(utilities.CanteraTest):
+    def setUp(self):
+        self.gas1 = ct.Solution('h2o2.xml')
+        self.gas2 = ct.Solution('h2o2.xml')
+        for gas in (self.gas1, self.gas2):
+            gas.TPX = 1000, 2*ct.one_atm, 'H2:2, O2:1, AR:4'
+
+    def compare(self, r1, r2, net, tEnd=1e-3):
+        for t in np.linspace(tEnd/10, tEnd, 10):
+            net.advance(t)
+            r2.advance(t)
+            self.assertNear(self.gas1.T, self.gas2.T, 1e-5)
+            self.assertNear(self.gas1.P, self.gas2.P, 1e-5)
+            self.assertArrayNear(self.gas1.Y, self.gas2.Y, 1e-5, 1e-10)
+
+    def test_constant_volume(self):
+        r1 = ct.IdealGasReactor(self.gas1)
+        r1.volume = 0.2
+        net = ct.ReactorNet([r1])
+        r2 = ct.ConfigurableReactor(self.gas2, volume_law='constant-volume',
+                                    volume=0.2)
+        self.assertEqual(r2.n_vars, self.gas2.n_species + 2)
+        self.compare(r1, r2, net)
+        self.assertNear(r2.volume, 0.2)
+        self.assertNear(r2.mass, r1.mass)
+
+    def test_constant_pressure_heat_loss(self):
+        env = ct.Reservoir(ct.Solution('h2o2.xml'))
+        r1 = ct.IdealGasConstPressureReactor(self.gas1)
+        r1.volume = 0.2
+        ct.Wall(r1, env, A=1.0, Q=500.0)
+        net = ct.ReactorNet([r1])
+        r2 = ct.ConfigurableReactor(self.gas2, volume=0.2, heat_loss=500.0)
+        self.compare(r1, r2, net)
+        self.assertNear(r2.volume, r1.volume)
+
+    def test_isothermal(self):
+        r1 = ct.IdealGasReactor(self.gas1, energy='off')
+        net = ct.ReactorNet([r1])
+        r2 = ct.ConfigurableReactor(self.gas2, volume_law='constant-volume',
+                                    energy='off')
+        self.assertFalse(r2.energy_enabled)
+        self.compare(r1, r2, net)
+        self.assertNear(self.gas2.T, 1000)
+
+    def test_species_source(self):
+        self.gas2.TPX = 300, ct.one_atm, 'AR:1'
+        r = ct.ConfigurableReactor(self.gas2, volume_law='constant-volume',
+                                   volume=0.5)
+        m0 = r.mass
+        kAr = self.gas2.species_index('AR')
+        r.set_species_source('AR', 1e-3)
+        r.advance(2.0)
+        self.assertNear(r.mass, m0 + 0.5 * 1e-3 * 2.0 * self.gas2.molecular_weights[kAr])
+        self.assertNear(self.gas2.T, 300)
+
+    def test_clear_species_source(self):
+        self.gas2.TPX = 300, ct.one_atm, 'AR:1'
+        r = ct.ConfigurableReactor(self.gas2, volume_law='constant-volume',
+                                   volume=0.5)
+        m0 = r.mass
+        kAr = self.gas2.species_index('AR')
+        r.set_species_source('AR', 1e-3)
+        r.advance(1.0)
+        m1 = m0 + 0.5 * 1e-3 * 1.0 * self.gas2.molecular_weights[kAr]
+        self.assertNear(r.mass, m1)
+
+        # no mass is added once the source is removed
+        r.clear_species_sources()
+        r.advance(2.0)
+        self.assertNear(r.mass, m1)
+        self.assertNear(self.gas2.T, 300)
+
+    def test_prescribed_volume(self):
+        # Isentropic compression of an inert mixture
+        self.gas2.TPX = 300, ct.one_atm, 'AR:1'
+        s0 = self.gas2.s
+        r = ct.ConfigurableReactor(self.gas2)
+        r.set_volume_function(lambda t: 1.0 - 0.5*t, lambda t: -0.5)
+        r.advance(1.0)
+        self.assertNear(r.volume, 0.5)
+        self.assertNear(self.gas2.s, s0, 1e-6)
+
+
 class TestSurfaceKinetics(utilities.CanteraTest):
     def make_reactors(self):
         self.net = ct.ReactorNet()
@@ -903,6 +1027,33 @@ class TestSurfaceKinetics(utilities.CanteraTest):
         self.assertNear(sum(C_left), 1.0)
         self.assertArrayNear(C_left, C_right)
 
+    def test_pseudo_steady_state_coverages(self):
+        self.make_reactors()
+        surf1 = ct.ReactorSurface(self.interface, self.r1)
+        surf2 = ct.ReactorSurface(self.interface, self.r2)
+        surf1.coverages = 'c6HH:0.3, c6HM:0.7'
+        surf2.coverages = 'c6HH:0.3, c6HM:0.7'
+        surf1.pseudo_steady_state = True
+        self.assertTrue(surf1.pseudo_steady_state)
+        self.assertFalse(surf2.pseudo_steady_state)
+
+        self.net.advance(1e-3)
+        self.assertEqual(self.net.n_vars,
+                         2 * (self.gas.n_species + 3) + self.interface.n_species)
+        self.assertNear(sum(surf1.coverages), 1.0)
+
+        # The pseudo-steady coverages give zero net production of the surface
+        # species at the current state of the reactor contents
+        self.interface.TP = self.gas.T, self.gas.P
+        self.interface.coverages = surf1.coverages
+        wdot = self.interface.get_net_production_rates(self.interface)
+        scale = max(self.interface.get_creation_rates(self.interface))
+        self.assertLess(max(abs(wdot)), 1e-6 * scale)
+
+        # the transient coverages relax to the pseudo-steady state values
+        self.net.advance(0.1)
+        self.assertArrayNear(surf1.coverages, surf2.coverages, 1e-4, 1e-10)
+
     def test_coverages_regression1(self):
         # Test with energy equation disabled
         self.make_reactors()
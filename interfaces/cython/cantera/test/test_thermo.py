@@ -545,6 +545,36 @@ class TestThermoPhase(utilities.CanteraTest):
         self.assertNear(sum(self.phase.partial_molar_cp * self.phase.X),
                         self.phase.cp_mole)
 
+    def test_get_thermo_array(self):
+        self.phase.TDY = 350.0, 0.6, 'H2:0.1, H2O2:0.1, AR:0.8'
+        h = np.empty(self.phase.n_species)
+        out = self.phase.get_thermo_array('partial_molar_enthalpies', h)
+        self.assertIs(out, h)
+        self.assertArrayNear(h, self.phase.partial_molar_enthalpies)
+        self.phase.get_thermo_array('X', h)
+        self.assertArrayNear(h, self.phase.X)
+
+        with self.assertRaises(ValueError):
+            self.phase.get_thermo_array('X', np.empty(2))
+        with self.assertRaises(ValueError):
+            self.phase.get_thermo_array('density', h)
+
+        state = np.empty(self.phase.n_species + 2)
+        self.phase.get_thermo_array('state', state)
+        self.assertArrayNear(state, self.phase.state)
+
+    def test_get_thermo_array_selected(self):
+        self.phase.TDY = 350.0, 0.6, 'H2:0.1, H2O2:0.1, AR:0.8'
+        sub = self.phase['H2O2', 'H2']
+        h = np.empty(2)
+        out = sub.get_thermo_array('partial_molar_enthalpies', h)
+        self.assertIs(out, h)
+        self.assertArrayNear(h, sub.partial_molar_enthalpies)
+        sub.get_thermo_array('Y', h)
+        self.assertArrayNear(h, [0.1, 0.1])
+        with self.assertRaises(ValueError):
+            sub.get_thermo_array('Y', np.empty(self.phase.n_species))
+
     def test_nondimensional(self):
         self.phase.TDY = 850.0, 0.2, 'H2:0.1, H2O:0.6, AR:0.3'
         H = (sum(self.phase.standard_enthalpies_RT * self.phase.X) *
@@ -32,6 +32,28 @@ class TestTransport(utilities.CanteraTest):
         self.assertArrayNear(Dbin1, Dbin2)
         self.assertArrayNear(Dbin1, Dbin1.T)
 
+    def test_get_transport_array(self):
+        D = np.empty(self.phase.n_species)
+        out = self.phase.get_transport_array('mix_diff_coeffs', D)
+        self.assertIs(out, D)
+        self.assertArrayNear(D, self.phase.mix_diff_coeffs)
+
+        Dbin = np.empty((self.phase.n_species, self.phase.n_species))
+        self.phase.get_transport_array('binary_diff_coeffs', Dbin)
+        self.assertArrayNear(Dbin, self.phase.binary_diff_coeffs)
+
+        sub = self.phase['H2', 'O2']
+        D2 = np.empty(2)
+        sub.get_transport_array('mix_diff_coeffs', D2)
+        self.assertArrayNear(D2, sub.mix_diff_coeffs)
+
+        with self.assertRaises(ValueError):
+            self.phase.get_transport_array('mix_diff_coeffs', Dbin)
+        with self.assertRaises(ValueError):
+            self.phase.get_transport_array('binary_diff_coeffs', D)
+        with self.assertRaises(ValueError):
+            self.phase.get_transport_array('viscosity', D)
+
     def test_multiComponent(self):
         with self.assertRaises(Exception):
             self.phase.Multi_diff_coeffs
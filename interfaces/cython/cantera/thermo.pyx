@@ -203,6 +203,41 @@ cdef class Species:
         return '<Species {}>'.format(self.name)
 
 
+cdef class _ThermoArrayGetter:
+    """ The C++ getter for one of the species properties of ThermoPhase """
+    cdef thermoMethod1d method
+
+cdef _ThermoArrayGetter _thermo_array_getter(thermoMethod1d method):
+    cdef _ThermoArrayGetter getter = _ThermoArrayGetter()
+    getter.method = method
+    return getter
+
+# Getters used by ThermoPhase.get_thermo_array, looked up by property name
+_thermo_array_getters = {
+    'molecular_weights': _thermo_array_getter(thermo_getMolecularWeights),
+    'Y': _thermo_array_getter(thermo_getMassFractions),
+    'X': _thermo_array_getter(thermo_getMoleFractions),
+    'concentrations': _thermo_array_getter(thermo_getConcentrations),
+    'partial_molar_enthalpies':
+        _thermo_array_getter(thermo_getPartialMolarEnthalpies),
+    'partial_molar_entropies':
+        _thermo_array_getter(thermo_getPartialMolarEntropies),
+    'partial_molar_int_energies':
+        _thermo_array_getter(thermo_getPartialMolarIntEnergies),
+    'chemical_potentials': _thermo_array_getter(thermo_getChemPotentials),
+    'electrochemical_potentials':
+        _thermo_array_getter(thermo_getElectrochemPotentials),
+    'partial_molar_cp': _thermo_array_getter(thermo_getPartialMolarCp),
+    'partial_molar_volumes':
+        _thermo_array_getter(thermo_getPartialMolarVolumes),
+    'standard_enthalpies_RT': _thermo_array_getter(thermo_getEnthalpy_RT),
+    'standard_entropies_R': _thermo_array_getter(thermo_getEntropy_R),
+    'standard_int_energies_RT': _thermo_array_getter(thermo_getIntEnergy_RT),
+    'standard_gibbs_RT': _thermo_array_getter(thermo_getGibbs_RT),
+    'standard_cp_R': _thermo_array_getter(thermo_getCp_R),
+}
+
+
 cdef class ThermoPhase(_SolutionBase):
     """
     A phase with an equation of state.
@@ -337,8 +372,11 @@ cdef class ThermoPhase(_SolutionBase):
         :param loglevel:
             Set to a value > 0 to write diagnostic output.
             """
-        self.thermo.equilibrate(stringify(XY.upper()), stringify(solver), rtol,
-                                maxsteps, maxiter, estimate_equil, loglevel)
+        cdef string cxy = stringify(XY.upper())
+        cdef string csolver = stringify(solver)
+        with nogil:
+            self.thermo.equilibrate(cxy, csolver, rtol, maxsteps, maxiter,
+                                    estimate_equil, loglevel)
 
     ####### Composition, species, and elements ########
 
@@ -477,13 +515,19 @@ cdef class ThermoPhase(_SolutionBase):
         return self.thermo.nAtoms(self.species_index(species),
                                   self.element_index(element))
 
-    cdef np.ndarray _getArray1(self, thermoMethod1d method):
-        cdef np.ndarray[np.double_t, ndim=1] data = np.empty(self.n_species)
-        method(self.thermo, &data[0])
+    cdef np.ndarray _getArray1(self, thermoMethod1d method,
+                               np.ndarray out=None):
+        cdef np.ndarray[np.double_t, ndim=1] data
         if self._selected_species.size:
-            return data[self._selected_species]
-        else:
-            return data
+            data = species_work_array(self, self.n_species)
+            method(self.thermo, &data[0])
+            if out is None:
+                return data[self._selected_species]
+            out = output_array(out, len(self._selected_species))
+            return np.take(data, self._selected_species, out=out)
+        data = output_array(out, self.n_species)
+        method(self.thermo, &data[0])
+        return data
 
     cdef void _setArray1(self, thermoMethod1d method, values) except *:
         cdef np.ndarray[np.double_t, ndim=1] data
@@ -1210,6 +1254,27 @@ cdef class ThermoPhase(_SolutionBase):
         def __get__(self):
             return self._getArray1(thermo_getCp_R)
 
+    def get_thermo_array(self, name, np.ndarray out not None):
+        """
+        Write the values of the species property *name*, or of the `state`,
+        into the existing array *out* and return it. For example,
+        ``gas.get_thermo_array('partial_molar_enthalpies', h)`` has the same
+        result as ``h[:] = gas.partial_molar_enthalpies``, but does not
+        allocate a new array. *out* must be a writable, contiguous array of
+        doubles of the same length as the property.
+        """
+        cdef np.ndarray[np.double_t, ndim=1] data
+        cdef _ThermoArrayGetter getter
+        if name == 'state':
+            data = output_array(out, self.n_species + 2)
+            self.thermo.saveState(len(data), &data[0])
+            return data
+        getter = _thermo_array_getters.get(name)
+        if getter is None:
+            raise ValueError("'{}' is not an array property of class "
+                             "ThermoPhase".format(name))
+        return self._getArray1(getter.method, out)
+
     ######## Miscellaneous properties ########
     property isothermal_compressibility:
         """Isothermal compressibility [1/Pa]."""
@@ -1,21 +1,72 @@
 # NOTE: These cdef functions cannot be members of Transport because they would
 # cause "layout conflicts" when creating derived classes with multiple bases,
 # e.g. class Solution. [Cython 0.16]
-cdef np.ndarray get_transport_1d(Transport tran, transportMethod1d method):
-    cdef np.ndarray[np.double_t, ndim=1] data = np.empty(tran.thermo.nSpecies())
-    method(tran.transport, &data[0])
+cdef np.ndarray get_transport_1d(Transport tran, transportMethod1d method,
+                                 np.ndarray out=None):
+    cdef np.ndarray[np.double_t, ndim=1] data
     if tran._selected_species.size:
-        return data[tran._selected_species]
-    else:
-        return data
+        data = species_work_array(tran, tran.thermo.nSpecies())
+        method(tran.transport, &data[0])
+        if out is None:
+            return data[tran._selected_species]
+        out = output_array(out, len(tran._selected_species))
+        return np.take(data, tran._selected_species, out=out)
+    data = output_array(out, tran.thermo.nSpecies())
+    method(tran.transport, &data[0])
+    return data
 
-cdef np.ndarray get_transport_2d(Transport tran, transportMethod2d method):
+cdef np.ndarray get_transport_2d(Transport tran, transportMethod2d method,
+                                 np.ndarray out=None):
     cdef size_t kk = tran.thermo.nSpecies()
-    cdef np.ndarray[np.double_t, ndim=2] data = np.empty((kk, kk))
+    cdef np.ndarray[np.double_t, ndim=2] data
+    if out is None:
+        data = np.empty((kk, kk))
+    elif (out.ndim != 2 or out.shape[0] != kk or out.shape[1] != kk or
+          out.dtype != np.double or not out.flags.c_contiguous or
+          not out.flags.writeable):
+        raise ValueError("Output array must be a writable, contiguous "
+                         "{0}x{0} array of doubles".format(kk))
+    else:
+        data = out
     method(tran.transport, kk, &data[0,0])
     return data
 
 
+cdef class _TransportArrayGetter:
+    """
+    The C++ getter for one of the array properties of Transport, which has
+    one value for each species or for each pair of species.
+    """
+    cdef transportMethod1d method1d
+    cdef transportMethod2d method2d
+
+cdef _TransportArrayGetter _transport_array_getter_1d(transportMethod1d method):
+    cdef _TransportArrayGetter getter = _TransportArrayGetter()
+    getter.method1d = method
+    getter.method2d = NULL
+    return getter
+
+cdef _TransportArrayGetter _transport_array_getter_2d(transportMethod2d method):
+    cdef _TransportArrayGetter getter = _TransportArrayGetter()
+    getter.method1d = NULL
+    getter.method2d = method
+    return getter
+
+# Getters used by Transport.get_transport_array, looked up by property name
+_transport_array_getters = {
+    'mix_diff_coeffs': _transport_array_getter_1d(tran_getMixDiffCoeffs),
+    'mix_diff_coeffs_mass':
+        _transport_array_getter_1d(tran_getMixDiffCoeffsMass),
+    'mix_diff_coeffs_mole':
+        _transport_array_getter_1d(tran_getMixDiffCoeffsMole),
+    'thermal_diff_coeffs':
+        _transport_array_getter_1d(tran_getThermalDiffCoeffs),
+    'multi_diff_coeffs': _transport_array_getter_2d(tran_getMultiDiffCoeffs),
+    'binary_diff_coeffs':
+        _transport_array_getter_2d(tran_getBinaryDiffCoeffs),
+}
+
+
 cdef class GasTransportData:
     """
     Transport data for a single gas-phase species which can be used in
@@ -197,6 +248,23 @@ cdef class Transport(_SolutionBase):
         def __get__(self):
             return get_transport_2d(self, tran_getBinaryDiffCoeffs)
 
+    def get_transport_array(self, name, np.ndarray out not None):
+        """
+        Write the values of the array-valued property *name* into the
+        existing array *out* and return it. For example,
+        ``gas.get_transport_array('mix_diff_coeffs', D)`` has the same result
+        as ``D[:] = gas.mix_diff_coeffs``, but does not allocate a new array.
+        *out* must be a writable, contiguous array of doubles of the same
+        shape as the property.
+        """
+        cdef _TransportArrayGetter getter = _transport_array_getters.get(name)
+        if getter is None:
+            raise ValueError("'{}' is not an array-valued property of class "
+                             "Transport".format(name))
+        if getter.method2d != NULL:
+            return get_transport_2d(self, getter.method2d, out)
+        return get_transport_1d(self, getter.method1d, out)
+
 
 cdef class DustyGasTransport(Transport):
     """
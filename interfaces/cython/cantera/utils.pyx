@@ -47,5 +47,18 @@ cdef Composition comp_map(X) except *:
         m[stringify(species)] = value
     return m
 
+cdef np.ndarray output_array(np.ndarray out, size_t n):
+    """
+    Return *out* after checking that it can receive *n* values from a C++
+    getter, or a new array of length *n* if *out* is None.
+    """
+    if out is None:
+        return np.empty(n)
+    if (out.ndim != 1 or out.shape[0] != n or out.dtype != np.double or
+        not out.flags.c_contiguous or not out.flags.writeable):
+        raise ValueError("Output array must be a writable, contiguous 1D "
+                         "array of {} doubles".format(n))
+    return out
+
 cdef comp_map_to_dict(Composition m):
     return {pystr(species):value for species,value in m.items()}
@@ -0,0 +1,110 @@
+/**
+ *  @file WorkerThreads.cpp
+ */
+
+#include "cantera/base/WorkerThreads.h"
+#include "cantera/base/ctexceptions.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+WorkerThreads::WorkerThreads(size_t nThreads) :
+    m_task(0),
+    m_nTasks(0),
+    m_generation(0),
+    m_pending(0),
+    m_stop(false)
+{
+    nThreads = std::max<size_t>(nThreads, 1);
+    m_errors.resize(nThreads);
+    for (size_t i = 1; i < nThreads; i++) {
+        m_threads.emplace_back(&WorkerThreads::work, this, i);
+    }
+}
+
+WorkerThreads::~WorkerThreads()
+{
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_start.notify_all();
+    for (auto& t : m_threads) {
+        t.join();
+    }
+}
+
+void WorkerThreads::run(size_t n, const function<void(size_t)>& task)
+{
+    if (n > nThreads()) {
+        throw CanteraError("WorkerThreads::run",
+            "Number of tasks ({}) exceeds the number of threads ({})",
+            n, nThreads());
+    }
+    if (n == 0) {
+        return;
+    }
+    for (auto& err : m_errors) {
+        err = nullptr;
+    }
+    if (n > 1) {
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_task = &task;
+            m_nTasks = n;
+            m_pending = n - 1;
+            m_generation++;
+        }
+        m_start.notify_all();
+    }
+    try {
+        task(0);
+    } catch (...) {
+        m_errors[0] = current_exception();
+    }
+    if (n > 1) {
+        unique_lock<mutex> lock(m_mutex);
+        m_done.wait(lock, [this]() { return m_pending == 0; });
+        m_task = 0;
+    }
+    for (auto& err : m_errors) {
+        if (err) {
+            exception_ptr e = err;
+            err = nullptr;
+            rethrow_exception(e);
+        }
+    }
+}
+
+void WorkerThreads::work(size_t i)
+{
+    size_t generation = 0;
+    unique_lock<mutex> lock(m_mutex);
+    while (true) {
+        m_start.wait(lock, [&]() {
+            return m_stop || m_generation != generation;
+        });
+        if (m_stop) {
+            return;
+        }
+        generation = m_generation;
+        if (i >= m_nTasks) {
+            continue;
+        }
+        const function<void(size_t)>& task = *m_task;
+        lock.unlock();
+        try {
+            task(i);
+        } catch (...) {
+            m_errors[i] = current_exception();
+        }
+        lock.lock();
+        if (--m_pending == 0) {
+            m_done.notify_one();
+        }
+    }
+}
+
+}
@@ -96,17 +96,35 @@ void Application::Messages::writelogendl()
 //! Mutex for access to string messages
 static std::mutex msg_mutex;
 
+//! Mutex for the set of deprecation warnings that have been issued
+static std::mutex warnings_mutex;
+
+//! Source of unique identifiers for ThreadMessages objects
+static std::atomic<size_t> thread_messages_count(0);
+
+thread_local size_t Application::ThreadMessages::s_cachedId = 0;
+thread_local Application::Messages*
+    Application::ThreadMessages::s_cachedMessages = 0;
+
+Application::ThreadMessages::ThreadMessages() :
+    m_id(++thread_messages_count)
+{
+}
+
 Application::Messages* Application::ThreadMessages::operator ->()
 {
+    if (s_cachedId == m_id) {
+        return s_cachedMessages;
+    }
     std::unique_lock<std::mutex> msgLock(msg_mutex);
     std::thread::id curId = std::this_thread::get_id();
     auto iter = m_threadMsgMap.find(curId);
-    if (iter != m_threadMsgMap.end()) {
-        return iter->second.get();
+    if (iter == m_threadMsgMap.end()) {
+        iter = m_threadMsgMap.insert({curId, pMessages_t(new Messages())}).first;
     }
-    pMessages_t pMsgs(new Messages());
-    m_threadMsgMap.insert({curId, pMsgs});
-    return pMsgs.get();
+    s_cachedId = m_id;
+    s_cachedMessages = iter->second.get();
+    return s_cachedMessages;
 }
 
 void Application::ThreadMessages::removeThreadMessages()
@@ -117,6 +135,10 @@ void Application::ThreadMessages::removeThreadMessages()
     if (iter != m_threadMsgMap.end()) {
         m_threadMsgMap.erase(iter);
     }
+    if (s_cachedId == m_id) {
+        s_cachedId = 0;
+        s_cachedMessages = 0;
+    }
 }
 
 Application::Application() :
@@ -131,6 +153,11 @@ Application::Application() :
 
 Application* Application::Instance()
 {
+    // Only lock the mutex if the Application may need to be created
+    Application* app = s_app.load(std::memory_order_acquire);
+    if (app) {
+        return app;
+    }
     std::unique_lock<std::mutex> appLock(app_mutex);
     if (Application::s_app == 0) {
         Application::s_app = new Application();
@@ -151,8 +178,7 @@ void Application::ApplicationDestroy()
 {
     std::unique_lock<std::mutex> appLock(app_mutex);
     if (Application::s_app != 0) {
-        delete Application::s_app;
-        Application::s_app = 0;
+        delete Application::s_app.exchange(0);
     }
 }
 
@@ -161,10 +187,14 @@ void Application::warn_deprecated(const std::string& method,
 {
     if (m_fatal_deprecation_warnings) {
         throw CanteraError(method, "Deprecated: " + extra);
-    } else if (m_suppress_deprecation_warnings || warnings.count(method)) {
+    } else if (m_suppress_deprecation_warnings) {
+        return;
+    }
+    std::unique_lock<std::mutex> warningsLock(warnings_mutex);
+    if (!warnings.insert(method).second) {
         return;
     }
-    warnings.insert(method);
+    warningsLock.unlock();
     writelog("WARNING: '" + method + "' is deprecated. " + extra);
     writelogendl();
 }
@@ -430,6 +460,6 @@ std::string Application::findInputFile(const std::string& name)
     return name;
 }
 
-Application* Application::s_app = 0;
+std::atomic<Application*> Application::s_app(0);
 
 } // namespace Cantera
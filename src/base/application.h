@@ -7,6 +7,7 @@
 
 #include <set>
 #include <thread>
+#include <atomic>
 
 namespace Cantera
 {
@@ -153,11 +154,16 @@ protected:
 
     //! Class that stores thread messages for each thread, and retrieves them
     //! based on the thread id.
+    /*!
+     * The Messages object of the current thread is cached in thread-local
+     * storage, so the map of all threads' messages, and the mutex protecting
+     * it, are only used the first time each thread accesses its messages.
+     */
     class ThreadMessages
     {
     public:
         //! Constructor
-        ThreadMessages() {}
+        ThreadMessages();
 
         //! Provide a pointer dereferencing overloaded operator
         /*!
@@ -174,6 +180,18 @@ protected:
     private:
         //! Thread Msg Map
         threadMsgMap_t m_threadMsgMap;
+
+        //! Unique identifier of this object, used to check that the cached
+        //! messages of a thread belong to this object rather than to an
+        //! Application which has since been destroyed.
+        size_t m_id;
+
+        //! Identifier of the object whose messages are cached for the current
+        //! thread
+        static thread_local size_t s_cachedId;
+
+        //! Cached messages of the current thread
+        static thread_local Messages* s_cachedMessages;
     };
 
 protected:
@@ -385,7 +403,7 @@ protected:
 
 private:
     //! Pointer to the single Application instance
-    static Application* s_app;
+    static std::atomic<Application*> s_app;
 };
 
 }
@@ -12,9 +12,21 @@
 #include "cantera/base/ct_defs.h"
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/ctexceptions.h"
+#include "cantera/base/utilities.h"
+
+#include <atomic>
 
 namespace Cantera {
 
+//! Interval between the checks performed by CheckFiniteSampled()
+static std::atomic<size_t> finite_check_interval(1);
+
+//! True if CheckFiniteSampled() throws an exception for non-finite values
+static std::atomic<bool> finite_check_throws(true);
+
+//! Number of arrays found by CheckFiniteSampled() to contain non-finite values
+static std::atomic<size_t> non_finite_count(0);
+
 void checkFinite(const double tmp)
 {
     if (!std::isfinite(tmp)) {
@@ -28,7 +40,7 @@ void checkFinite(const double tmp)
     }
 }
 
-void checkFinite(const std::string& name, double* values, size_t N)
+void checkFinite(const std::string& name, const double* values, size_t N)
 {
     for (size_t i = 0; i < N; i++) {
         if (!std::isfinite(values[i])) {
@@ -43,4 +55,48 @@ void checkFinite(const std::string& name, double* values, size_t N)
     }
 }
 
+void setFiniteCheckInterval(size_t n)
+{
+    finite_check_interval = n;
+}
+
+size_t finiteCheckInterval()
+{
+    return finite_check_interval;
+}
+
+void setFiniteCheckThrows(bool throws)
+{
+    finite_check_throws = throws;
+}
+
+size_t nonFiniteCount()
+{
+    return non_finite_count;
+}
+
+void resetNonFiniteCount()
+{
+    non_finite_count = 0;
+}
+
+bool finiteCheckDue(unsigned long& count)
+{
+    size_t n = finite_check_interval.load(std::memory_order_relaxed);
+    return n != 0 && ++count % n == 0;
+}
+
+void checkFiniteCounted(const char* name, const double* values, size_t N)
+{
+    for (size_t i = 0; i < N; i++) {
+        if (!std::isfinite(values[i])) {
+            non_finite_count++;
+            if (finite_check_throws.load(std::memory_order_relaxed)) {
+                checkFinite(name, values, N);
+            }
+            return;
+        }
+    }
+}
+
 }
@@ -8,6 +8,8 @@
 #include "cantera/base/stringUtils.h"
 #include "cantera/base/Array.h"
 
+#include <algorithm>
+
 using namespace std;
 
 namespace Cantera
@@ -335,23 +337,21 @@ size_t getFloatArray(const XML_Node& node, vector_fp & v,
         vmax = fpValueCheck(readNode->attrib("max"));
     }
 
-    std::string val = readNode->value();
-    while (true) {
-        size_t icom = val.find(',');
-        if (icom != string::npos) {
-            string numstr = val.substr(0,icom);
-            val = val.substr(icom+1,val.size());
-            v.push_back(fpValueCheck(numstr));
-        } else {
-            // This little bit of code is to allow for the possibility of a
-            // comma being the last item in the value text. This was allowed in
-            // previous versions of Cantera, even though it would appear to be
-            // odd. So, we keep the possibility in for backwards compatibility.
-            if (!val.empty()) {
-                v.push_back(fpValueCheck(val));
-            }
+    // Split the value at commas in a single pass. A comma as the last item in
+    // the value text was allowed in previous versions of Cantera, even though
+    // it would appear to be odd. So, we keep the possibility in for backwards
+    // compatibility.
+    const std::string& val = readNode->value();
+    v.reserve(std::count(val.begin(), val.end(), ',') + 1);
+    size_t start = 0;
+    while (start < val.size()) {
+        size_t icom = std::min(val.find(',', start), val.size());
+        if (icom == val.size() &&
+            val.find_first_not_of(" \t\n\r", start) == string::npos) {
             break;
         }
+        v.push_back(fpValueCheck(val.substr(start, icom - start)));
+        start = icom + 1;
         doublereal vv = v.back();
         if (vmin != Undef && vv < vmin - Tiny) {
             writelog("\nWarning: value {} is below lower limit of {}.\n",
@@ -22,6 +22,8 @@
 
 #include <sstream>
 #include <cstdio>
+#include <cstdlib>
+#include <clocale>
 
 namespace Cantera
 {
@@ -233,6 +235,11 @@ doublereal fpValueCheck(const std::string& val)
                                "Trouble processing string, " + str);
         }
     }
+    // strtod is much faster than a stringstream, and accepts any string
+    // which passes the above checks, but depends on the locale
+    if (*localeconv()->decimal_point == '.') {
+        return strtod(str.c_str(), 0);
+    }
     return fpValue(str);
 }
 
@@ -13,6 +13,10 @@
 
 #include <sstream>
 #include <fstream>
+#include <algorithm>
+#include <climits>
+#include <mutex>
+#include <unordered_map>
 
 using namespace std;
 
@@ -111,19 +115,31 @@ public:
 //////////////////// XML_Reader methods ///////////////////////
 
 XML_Reader::XML_Reader(std::istream& input) :
-    m_s(input),
+    m_pos(0),
     m_line(0)
 {
+    std::ostringstream contents;
+    contents << input.rdbuf();
+    m_buf = contents.str();
 }
 
 void XML_Reader::getchr(char& ch)
 {
-    m_s.get(ch);
-    if (ch == '\n') {
-        m_line++;
+    if (m_pos < m_buf.size()) {
+        ch = m_buf[m_pos++];
+        if (ch == '\n') {
+            m_line++;
+        }
     }
 }
 
+void XML_Reader::advance(size_t pos)
+{
+    m_line += static_cast<int>(std::count(m_buf.begin() + m_pos,
+                                          m_buf.begin() + pos, '\n'));
+    m_pos = pos;
+}
+
 //! Find the first position of a character, q, in string, s, which is not
 //! immediately preceded by the backslash character
 /*!
@@ -228,41 +244,39 @@ void XML_Reader::parseTag(const std::string& tag, std::string& name,
 
 std::string XML_Reader::readTag(std::map<std::string, std::string>& attribs)
 {
-    string tag = "";
-    bool incomment = false;
-    char ch = '-';
-    while (true) {
-        if (m_s.eof() || (getchr(ch), ch == '<')) {
-            break;
-        }
+    size_t start = m_buf.find('<', m_pos);
+    if (start == string::npos) {
+        advance(m_buf.size());
+        return "EOF";
     }
-    char ch1 = ' ', ch2 = ' ';
-    while (true) {
-        if (m_s.eof()) {
-            tag = "EOF";
-            break;
-        }
-        ch2 = ch1;
-        ch1 = ch;
-        getchr(ch);
-        if (ch == '-') {
-            if (ch1 == '-' && ch2 == '!') {
-                incomment = true;
-                tag = "-";
-            }
-        } else if (ch == '>') {
-            if (incomment) {
-                if (ch1 == '-' && ch2 == '-') {
-                    break;
-                }
-            } else {
-                break;
-            }
+    start++;
+
+    // Comments end at the first occurrence of "-->"; other tags at the first
+    // '>'. Non-printing characters are dropped from the tag.
+    bool incomment = (m_buf.compare(start, 3, "!--") == 0);
+    size_t end;
+    if (incomment) {
+        end = m_buf.find("-->", start + 1);
+        if (end != string::npos) {
+            end += 2;
         }
-        if (isprint(ch)) {
-            tag += ch;
+        start++;
+    } else {
+        end = m_buf.find('>', start);
+    }
+    if (end == string::npos) {
+        advance(m_buf.size());
+        return "EOF";
+    }
+    string tag;
+    tag.reserve(end - start);
+    for (size_t i = start; i < end; i++) {
+        if (isprint(static_cast<unsigned char>(m_buf[i]))) {
+            tag += m_buf[i];
         }
     }
+    advance(end + 1);
+
     if (incomment) {
         attribs.clear();
         return tag;
@@ -275,34 +289,129 @@ std::string XML_Reader::readTag(std::map<std::string, std::string>& attribs)
 
 std::string XML_Reader::readValue()
 {
-    string tag = "";
-    char ch = '\n';
-    bool front = true;
-    while (true) {
-        if (m_s.eof()) {
-            break;
+    size_t end = std::min(m_buf.find('<', m_pos), m_buf.size());
+    string value;
+    value.reserve(end - m_pos);
+
+    // Repeated spaces at the start of each line are collapsed to a single
+    // space
+    size_t i = m_pos;
+    while (i < end) {
+        if (m_buf[i] == ' ') {
+            value += ' ';
+            i = std::min(m_buf.find_first_not_of(' ', i), end);
         }
-        char lastch = ch;
-        getchr(ch);
-        if (ch == '\n') {
-            front = true;
-        } else if (ch != ' ') {
-            front = false;
+        size_t eol = std::find(m_buf.begin() + i, m_buf.begin() + end, '\n')
+                     - m_buf.begin();
+        eol = std::min(eol + 1, end);
+        value.append(m_buf, i, eol - i);
+        i = eol;
+    }
+    advance(end);
+    return stripws(value);
+}
+
+//////////////////////////  XML_Node  /////////////////////////////////
+
+namespace {
+//! Guards the creation and use of the lookup tables of all XML trees
+std::mutex xml_index_mutex;
+}
+
+struct XML_Node::Index
+{
+    typedef std::unordered_map<std::string, std::vector<XML_Node*>> NodeMap;
+
+    //! Create the lookup tables for the tree with the given root
+    explicit Index(XML_Node& root) {
+        // Number the nodes in depth-first order
+        std::vector<XML_Node*> stack{&root};
+        root.m_depth = 0;
+        while (!stack.empty()) {
+            XML_Node* node = stack.back();
+            stack.pop_back();
+            node->m_order = nodes.size();
+            nodes.push_back(node);
+            byName[node->m_name].push_back(node);
+            for (size_t i = node->m_children.size(); i > 0; i--) {
+                XML_Node* child = node->m_children[i-1];
+                child->m_depth = node->m_depth + 1;
+                stack.push_back(child);
+            }
         }
-        if (ch == '<') {
-            m_s.putback(ch);
-            break;
+        // The subtree of each node ends with the subtree of its last child
+        for (size_t i = nodes.size(); i > 0; i--) {
+            XML_Node* node = nodes[i-1];
+            if (node->m_children.empty()) {
+                node->m_end = node->m_order + 1;
+            } else {
+                node->m_end = node->m_children.back()->m_end;
+            }
         }
-        if (front && lastch == ' ' && ch == ' ') {
-            ;
-        } else {
-            tag += ch;
+    }
+
+    //! Nodes with each value of the attribute *attr*, in depth-first order
+    const NodeMap& attribTable(const std::string& attr) {
+        auto iter = byAttrib.find(attr);
+        if (iter == byAttrib.end()) {
+            iter = byAttrib.emplace(attr, NodeMap()).first;
+            for (auto node : nodes) {
+                auto a = node->m_attribs.find(attr);
+                if (a != node->m_attribs.end()) {
+                    iter->second[a->second].push_back(node);
+                }
+            }
         }
+        return iter->second;
     }
-    return stripws(tag);
-}
 
-//////////////////////////  XML_Node  /////////////////////////////////
+    //! Find the nodes with key *key* in *table*, or return null
+    static const std::vector<XML_Node*>* lookup(const NodeMap& table,
+                                                const std::string& key) {
+        auto iter = table.find(key);
+        return (iter == table.end()) ? 0 : &iter->second;
+    }
+
+    //! Return an iterator to the first of *candidates*, a list of nodes in
+    //! depth-first order, which is not before *node*
+    static std::vector<XML_Node*>::const_iterator
+    start(const std::vector<XML_Node*>& candidates, const XML_Node* node) {
+        return std::lower_bound(candidates.begin(), candidates.end(),
+            node->m_order, [](const XML_Node* n, size_t order) {
+                return n->m_order < order;
+            });
+    }
+
+    //! Return the first of *candidates*, a list of nodes in depth-first
+    //! order, which is in the subtree of *node* and at most *depth* levels
+    //! below it. This is the node found first by a depth-first search.
+    static XML_Node* first(const std::vector<XML_Node*>* candidates,
+                           const XML_Node* node, int depth) {
+        if (!candidates) {
+            return 0;
+        }
+        depth = std::max(depth, 0);
+        for (auto iter = start(*candidates, node);
+             iter != candidates->end() && (*iter)->m_order < node->m_end;
+             ++iter) {
+            if ((*iter)->m_depth - node->m_depth <= depth) {
+                return *iter;
+            }
+        }
+        return 0;
+    }
+
+    //! All nodes in the tree, in depth-first order
+    std::vector<XML_Node*> nodes;
+
+    //! Nodes with each name, in depth-first order
+    NodeMap byName;
+
+    //! Nodes with each value of an attribute, in depth-first order. Created
+    //! for each attribute the first time it is searched for.
+    std::unordered_map<std::string, NodeMap> byAttrib;
+};
+
 
 XML_Node::XML_Node(const std::string& nm, XML_Node* const parent_) :
     m_name(nm),
@@ -310,7 +419,10 @@ XML_Node::XML_Node(const std::string& nm, XML_Node* const parent_) :
     m_root(0),
     m_locked(false),
     m_iscomment(false),
-    m_linenum(0)
+    m_linenum(0),
+    m_order(npos),
+    m_end(0),
+    m_depth(0)
 {
     if (!parent_) {
         m_root = this;
@@ -324,7 +436,10 @@ XML_Node::XML_Node(const XML_Node& right) :
     m_root(0),
     m_locked(false),
     m_iscomment(right.m_iscomment),
-    m_linenum(right.m_linenum)
+    m_linenum(right.m_linenum),
+    m_order(npos),
+    m_end(0),
+    m_depth(0)
 {
     m_root = this;
     m_name = right.m_name;
@@ -342,6 +457,8 @@ XML_Node& XML_Node::operator=(const XML_Node& right)
             }
         }
         m_children.resize(0);
+        m_childindex.clear();
+        invalidateIndex();
         right.copy(this);
     }
     return *this;
@@ -375,6 +492,7 @@ void XML_Node::clear()
 
     m_iscomment = false;
     m_linenum = 0;
+    invalidateIndex();
 }
 
 void XML_Node::addComment(const std::string& comment)
@@ -388,6 +506,7 @@ XML_Node& XML_Node::mergeAsChild(XML_Node& node)
     m_childindex.insert({node.name(), m_children.back()});
     node.setRoot(root());
     node.setParent(this);
+    invalidateIndex();
     return *m_children.back();
 }
 
@@ -420,7 +539,19 @@ void XML_Node::removeChild(const XML_Node* const node)
 {
     auto i = find(m_children.begin(), m_children.end(), node);
     m_children.erase(i);
-    m_childindex.erase(node->name());
+    auto range = m_childindex.equal_range(node->name());
+    for (auto j = range.first; j != range.second; ++j) {
+        if (j->second == node) {
+            m_childindex.erase(j);
+            break;
+        }
+    }
+    invalidateIndex();
+
+    // The removed node becomes the root of a separate tree
+    XML_Node* removed = const_cast<XML_Node*>(node);
+    removed->setParent(0);
+    removed->setRoot(*removed);
 }
 
 std::string XML_Node::id() const
@@ -472,22 +603,23 @@ std::string XML_Node::operator()(const std::string& loc) const
 void XML_Node::addAttribute(const std::string& attrib, const std::string& value)
 {
     m_attribs[attrib] = value;
+    invalidateIndex();
 }
 
 void XML_Node::addAttribute(const std::string& attrib,
                             const doublereal vvalue, const std::string& fmt)
 {
-    m_attribs[attrib] = fmt::sprintf(fmt, vvalue);
+    addAttribute(attrib, fmt::sprintf(fmt, vvalue));
 }
 
 void XML_Node::addAttribute(const std::string& aattrib, const int vvalue)
 {
-    m_attribs[aattrib] = fmt::format("{}", vvalue);
+    addAttribute(aattrib, fmt::format("{}", vvalue));
 }
 
 void XML_Node::addAttribute(const std::string& aattrib, const size_t vvalue)
 {
-    m_attribs[aattrib] = fmt::format("{}", vvalue);
+    addAttribute(aattrib, fmt::format("{}", vvalue));
 }
 
 std::string XML_Node::operator[](const std::string& attr) const
@@ -502,6 +634,7 @@ std::string XML_Node::attrib(const std::string& attr) const
 
 std::map<std::string,std::string>& XML_Node::attribs()
 {
+    invalidateIndex();
     return m_attribs;
 }
 
@@ -528,6 +661,7 @@ XML_Node* XML_Node::parent() const
 XML_Node* XML_Node::setParent(XML_Node* const p)
 {
     m_parent = p;
+    invalidateIndex();
     return p;
 }
 
@@ -584,6 +718,50 @@ void XML_Node::_require(const std::string& a, const std::string& v) const
 XML_Node* XML_Node::findNameID(const std::string& nameTarget,
                                const std::string& idTarget) const
 {
+    std::unique_lock<std::mutex> lock(xml_index_mutex);
+    Index* ind = index();
+    if (ind) {
+        // Candidates matching the name, or the id. Each step checks the
+        // current node and its children before descending into the subtree
+        // of the first child which contains a match.
+        const vector<XML_Node*>* candidates;
+        if (idTarget == "") {
+            candidates = Index::lookup(ind->byName, nameTarget);
+        } else {
+            candidates = Index::lookup(ind->attribTable("id"), idTarget);
+        }
+        if (!candidates) {
+            return 0;
+        }
+        const XML_Node* node = this;
+        while (true) {
+            XML_Node* first = 0;
+            for (auto iter = Index::start(*candidates, node);
+                 iter != candidates->end() && (*iter)->m_order < node->m_end;
+                 ++iter) {
+                XML_Node* sc = *iter;
+                if (sc->m_name != nameTarget) {
+                    continue;
+                } else if (sc == node || sc->m_depth == node->m_depth + 1) {
+                    return sc;
+                } else if (!first) {
+                    first = sc;
+                }
+            }
+            if (!first) {
+                return 0;
+            }
+            auto next = std::upper_bound(node->m_children.begin(),
+                node->m_children.end(), first->m_order,
+                [](size_t order, const XML_Node* n) {
+                    return order < n->m_order;
+                });
+            node = *(next - 1);
+        }
+    }
+    lock.unlock();
+
+    // This node is not part of the tree described by its root
     XML_Node* scResult = 0;
     std::string idattrib = id();
     if (name() == nameTarget && (idTarget == "" || idTarget == idattrib)) {
@@ -642,23 +820,21 @@ XML_Node* XML_Node::findNameIDIndex(const std::string& nameTarget,
 
 XML_Node* XML_Node::findID(const std::string& id_, const int depth) const
 {
-    if (hasAttrib("id") && attrib("id") == id_) {
-        return const_cast<XML_Node*>(this);
-    }
-    if (depth > 0) {
-        for (size_t i = 0; i < nChildren(); i++) {
-            XML_Node* r = m_children[i]->findID(id_, depth-1);
-            if (r != 0) {
-                return r;
-            }
-        }
-    }
-    return 0;
+    return findByAttr("id", id_, depth);
 }
 
 XML_Node* XML_Node::findByAttr(const std::string& attr,
                                const std::string& val, int depth) const
 {
+    std::unique_lock<std::mutex> lock(xml_index_mutex);
+    Index* ind = index();
+    if (ind) {
+        return Index::first(Index::lookup(ind->attribTable(attr), val), this,
+                            depth);
+    }
+    lock.unlock();
+
+    // This node is not part of the tree described by its root
     if (hasAttrib(attr) && attrib(attr) == val) {
         return const_cast<XML_Node*>(this);
     }
@@ -676,6 +852,22 @@ XML_Node* XML_Node::findByAttr(const std::string& attr,
 
 XML_Node* XML_Node::findByName(const std::string& nm, int depth)
 {
+    const XML_Node* r = static_cast<const XML_Node*>(this)->findByName(nm, depth);
+    return const_cast<XML_Node*>(r);
+}
+
+const XML_Node* XML_Node::findByName(const std::string& nm, int depth) const
+{
+    // Note that a positive depth always searches the whole subtree
+    std::unique_lock<std::mutex> lock(xml_index_mutex);
+    Index* ind = index();
+    if (ind) {
+        return Index::first(Index::lookup(ind->byName, nm), this,
+                            (depth > 0) ? INT_MAX : 0);
+    }
+    lock.unlock();
+
+    // This node is not part of the tree described by its root
     if (name() == nm) {
         return this;
     }
@@ -690,20 +882,30 @@ XML_Node* XML_Node::findByName(const std::string& nm, int depth)
     return 0;
 }
 
-const XML_Node* XML_Node::findByName(const std::string& nm, int depth) const
+XML_Node::Index* XML_Node::index() const
 {
-    if (name() == nm) {
-        return const_cast<XML_Node*>(this);
+    XML_Node& r = root();
+    if (!r.m_index) {
+        r.m_index.reset(new Index(r));
     }
-    if (depth > 0) {
-        for (size_t i = 0; i < nChildren(); i++) {
-            XML_Node* r = m_children[i]->findByName(nm);
-            if (r != 0) {
-                return r;
-            }
-        }
+    Index* ind = r.m_index.get();
+    if (m_order < ind->nodes.size() && ind->nodes[m_order] == this) {
+        return ind;
+    } else {
+        return 0;
     }
-    return 0;
+}
+
+void XML_Node::invalidateIndex()
+{
+    // Modifying a tree requires exclusive access to it, so no other thread
+    // can be creating its lookup tables. Trees without lookup tables, e.g.
+    // while parsing or copying, are modified without taking the lock.
+    if (!m_root->m_index) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(xml_index_mutex);
+    m_root->m_index.reset();
 }
 
 void XML_Node::writeHeader(std::ostream& s)
@@ -727,7 +929,7 @@ void XML_Node::build(std::istream& f, const std::string& filename)
     XML_Reader r(f);
     XML_Node* node = this;
     bool first = true;
-    while (!f.eof()) {
+    while (!r.eof()) {
         map<string, string> node_attribs;
         string nm = r.readTag(node_attribs);
 
@@ -1028,6 +1230,7 @@ XML_Node& XML_Node::root() const
 void XML_Node::setRoot(const XML_Node& newRoot)
 {
     m_root = const_cast<XML_Node*>(&newRoot);
+    invalidateIndex();
     for (size_t i = 0; i < m_children.size(); i++) {
         m_children[i]->setRoot(newRoot);
     }
@@ -1036,39 +1239,10 @@ void XML_Node::setRoot(const XML_Node& newRoot)
 XML_Node* findXMLPhase(XML_Node* root,
                        const std::string& idtarget)
 {
-    XML_Node* scResult = 0;
     if (!root) {
         return 0;
     }
-    if (root->name() == "phase") {
-        if (idtarget == "") {
-            return root;
-        }
-        if (idtarget == root->id()) {
-            return root;
-        }
-    }
-
-    const vector<XML_Node*> &vsc = root->children();
-    for (size_t n = 0; n < root->nChildren(); n++) {
-        XML_Node* sc = vsc[n];
-        if (sc->name() == "phase") {
-            if (idtarget == "") {
-                return sc;
-            }
-            if (idtarget == sc->id()) {
-                return sc;
-            }
-        }
-    }
-    for (size_t n = 0; n < root->nChildren(); n++) {
-        XML_Node* sc = vsc[n];
-        scResult = findXMLPhase(sc, idtarget);
-        if (scResult) {
-            return scResult;
-        }
-    }
-    return scResult;
+    return root->findNameID("phase", idtarget);
 }
 
 }
@@ -837,7 +837,8 @@ double ChemEquil::calcEmoles(thermo_t& s, vector_fp& x, const double& n_t,
 
     // Calculate the activity coefficients of the solution, at the previous
     // solution state.
-    vector_fp actCoeff(m_kk, 1.0);
+    vector_fp& actCoeff = m_actCoeff;
+    actCoeff.assign(m_kk, 1.0);
     s.setMoleFractions(Xmol_i_calc.data());
     s.setPressure(pressureConst);
     s.getActivityCoefficients(actCoeff.data());
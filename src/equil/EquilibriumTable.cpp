@@ -0,0 +1,634 @@
+/**
+ *  @file EquilibriumTable.cpp
+ *  Tabulation of the equilibrium states of mixtures of two streams (see
+ *  \ref equilfunctions and class
+ *  \link Cantera::EquilibriumTable EquilibriumTable\endlink).
+ */
+
+#include "cantera/equil/EquilibriumTable.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/base/ctml.h"
+#include "cantera/base/stringUtils.h"
+
+#include <numeric>
+#include <fstream>
+#include <thread>
+#include <exception>
+
+using namespace std;
+
+namespace Cantera
+{
+
+struct EquilibriumTable::Worker
+{
+    unique_ptr<ThermoPhase> phase;
+    vector_fp Y;
+};
+
+EquilibriumTable::EquilibriumTable(ThermoPhase& phase, size_t nThreads) :
+    m_phase(phase),
+    m_nsp(phase.nSpecies()),
+    m_Tmin(300.0),
+    m_Tmax(1500.0),
+    m_Pmin(OneAtm),
+    m_Pmax(OneAtm),
+    m_Ttol(1.0),
+    m_Ytol(1.0e-3),
+    m_maxLevel(6)
+{
+    if (nThreads == 0) {
+        nThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    m_workers.resize(nThreads);
+    m_n0[0] = 8;
+    m_n0[1] = 4;
+    m_n0[2] = 2;
+    m_hFuel[0] = m_hFuel[1] = m_hOx[0] = m_hOx[1] = 0.0;
+}
+
+EquilibriumTable::~EquilibriumTable()
+{
+}
+
+void EquilibriumTable::setStreams(const compositionMap& fuel,
+                                  const compositionMap& oxidizer)
+{
+    vector_fp state;
+    m_phase.saveState(state);
+    m_Yfuel.resize(m_nsp);
+    m_Yox.resize(m_nsp);
+    m_phase.setMoleFractionsByName(fuel);
+    m_phase.getMassFractions(m_Yfuel.data());
+    m_phase.setMoleFractionsByName(oxidizer);
+    m_phase.getMassFractions(m_Yox.data());
+    m_phase.restoreState(state);
+}
+
+void EquilibriumTable::setStreams(const std::string& fuel,
+                                  const std::string& oxidizer)
+{
+    setStreams(parseCompString(fuel, m_phase.speciesNames()),
+               parseCompString(oxidizer, m_phase.speciesNames()));
+}
+
+void EquilibriumTable::setTemperatureRange(double Tmin, double Tmax)
+{
+    if (Tmin <= 0.0 || Tmax <= Tmin) {
+        throw CanteraError("EquilibriumTable::setTemperatureRange",
+            "Invalid temperature range: [{}, {}]", Tmin, Tmax);
+    }
+    m_Tmin = Tmin;
+    m_Tmax = Tmax;
+}
+
+void EquilibriumTable::setPressureRange(double Pmin, double Pmax)
+{
+    if (Pmin <= 0.0 || Pmax < Pmin) {
+        throw CanteraError("EquilibriumTable::setPressureRange",
+            "Invalid pressure range: [{}, {}]", Pmin, Pmax);
+    }
+    m_Pmin = Pmin;
+    m_Pmax = Pmax;
+}
+
+void EquilibriumTable::setTolerances(double Ttol, double Ytol)
+{
+    m_Ttol = Ttol;
+    m_Ytol = Ytol;
+}
+
+void EquilibriumTable::setGrid(size_t nZ, size_t nh, size_t nP,
+                               size_t maxLevel)
+{
+    if (nZ == 0 || nh == 0 || nP == 0) {
+        throw CanteraError("EquilibriumTable::setGrid",
+                           "The initial grid must have at least one cell in "
+                           "each direction");
+    }
+    if (maxLevel > 16) {
+        throw CanteraError("EquilibriumTable::setGrid",
+                           "Maximum refinement level {} is too large", maxLevel);
+    }
+    m_n0[0] = nZ;
+    m_n0[1] = nh;
+    m_n0[2] = nP;
+    m_maxLevel = maxLevel;
+}
+
+double EquilibriumTable::unreactedEnthalpy(double Z, bool upper) const
+{
+    return Z * m_hFuel[upper] + (1.0 - Z) * m_hOx[upper];
+}
+
+void EquilibriumTable::getUnreactedMassFractions(double Z, double* Y) const
+{
+    for (size_t k = 0; k < m_nsp; k++) {
+        Y[k] = Z * m_Yfuel[k] + (1.0 - Z) * m_Yox[k];
+    }
+}
+
+void EquilibriumTable::latticeState(size_t i, size_t j, size_t k, double& Z,
+                                    double& h, double& P) const
+{
+    Z = double(i) / double(m_n0[0] << m_maxLevel);
+    double eta = double(j) / double(m_n0[1] << m_maxLevel);
+    double hlow = unreactedEnthalpy(Z, false);
+    h = hlow + eta * (unreactedEnthalpy(Z, true) - hlow);
+    if (nDims() == 3) {
+        double x = double(k) / double(m_n0[2] << m_maxLevel);
+        P = m_Pmin * exp(x * log(m_Pmax / m_Pmin));
+    } else {
+        P = m_Pmin;
+    }
+}
+
+int EquilibriumTable::addPoint(size_t i, size_t j, size_t k)
+{
+    size_t key = i + ((m_n0[0] << m_maxLevel) + 1) *
+                     (j + ((m_n0[1] << m_maxLevel) + 1) * k);
+    auto iter = m_pointIndex.find(key);
+    if (iter != m_pointIndex.end()) {
+        return iter->second;
+    }
+    int n = static_cast<int>(m_T.size());
+    m_pointIndex[key] = n;
+    m_T.push_back(0.0);
+    m_Y.resize(m_Y.size() + m_nsp);
+    m_pending.push_back(i);
+    m_pending.push_back(j);
+    m_pending.push_back(k);
+    return n;
+}
+
+void EquilibriumTable::computePoints()
+{
+    size_t n = m_pending.size() / 3;
+    size_t nw = std::min(m_workers.size(), n);
+    if (nw <= 1) {
+        computeBlock(*m_workers[0], 0, n);
+    } else {
+        vector<std::thread> threads;
+        vector<std::exception_ptr> errors(nw);
+        for (size_t i = 0; i < nw; i++) {
+            size_t i0 = (i * n) / nw;
+            size_t i1 = ((i + 1) * n) / nw;
+            threads.emplace_back([=, &errors]() {
+                try {
+                    computeBlock(*m_workers[i], i0, i1);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        for (auto& err : errors) {
+            if (err) {
+                m_pending.clear();
+                std::rethrow_exception(err);
+            }
+        }
+    }
+    m_pending.clear();
+}
+
+void EquilibriumTable::computeBlock(Worker& w, size_t i0, size_t i1)
+{
+    ThermoPhase& phase = *w.phase;
+    size_t first = m_T.size() - m_pending.size() / 3;
+    double Z, h, P;
+    for (size_t n = i0; n < i1; n++) {
+        latticeState(m_pending[3*n], m_pending[3*n+1], m_pending[3*n+2],
+                     Z, h, P);
+        getUnreactedMassFractions(Z, w.Y.data());
+        phase.setState_TPY(m_Tmin, P, w.Y.data());
+        phase.setState_HP(h, P);
+        try {
+            phase.equilibrate("HP");
+        } catch (CanteraError& err) {
+            throw CanteraError("EquilibriumTable::build",
+                "Equilibrium calculation failed at Z = {}, h = {}, P = {}:\n{}",
+                Z, h, P, err.getMessage());
+        }
+        m_T[first + n] = phase.temperature();
+        phase.getMassFractions(&m_Y[(first + n) * m_nsp]);
+    }
+}
+
+void EquilibriumTable::build()
+{
+    if (m_Yfuel.empty()) {
+        throw CanteraError("EquilibriumTable::build",
+                           "The fuel and oxidizer streams have not been set");
+    }
+    for (auto& w : m_workers) {
+        if (!w) {
+            const XML_Node& phaseNode = m_phase.xml();
+            if (!phaseNode.hasChild("thermo")) {
+                throw CanteraError("EquilibriumTable::build",
+                    "Phase '{}' was not created from an input file",
+                    m_phase.name());
+            }
+            w.reset(new Worker());
+            w->phase.reset(newPhase(phaseNode));
+            w->Y.resize(m_nsp);
+        }
+    }
+
+    // Enthalpy range of the unreacted streams
+    vector_fp state;
+    m_phase.saveState(state);
+    m_phase.setState_TPY(m_Tmin, m_Pmin, m_Yfuel.data());
+    m_hFuel[0] = m_phase.enthalpy_mass();
+    m_phase.setState_TPY(m_Tmax, m_Pmin, m_Yfuel.data());
+    m_hFuel[1] = m_phase.enthalpy_mass();
+    m_phase.setState_TPY(m_Tmin, m_Pmin, m_Yox.data());
+    m_hOx[0] = m_phase.enthalpy_mass();
+    m_phase.setState_TPY(m_Tmax, m_Pmin, m_Yox.data());
+    m_hOx[1] = m_phase.enthalpy_mass();
+    m_phase.restoreState(state);
+
+    m_cells.clear();
+    m_T.clear();
+    m_Y.clear();
+    m_pending.clear();
+    m_pointIndex.clear();
+
+    // Cells which may be refined, identified by their index, their lower
+    // corner on the lattice of the most refined level, and their size on
+    // this lattice.
+    struct Active {
+        size_t cell, i, j, k, size;
+    };
+    vector<Active> active;
+
+    size_t nd = nDims();
+    size_t nc = size_t(1) << nd; // number of corners
+    size_t s = size_t(1) << m_maxLevel;
+    size_t nP = (nd == 3) ? m_n0[2] : 1;
+    for (size_t c = 0; c < nP; c++) {
+        for (size_t b = 0; b < m_n0[1]; b++) {
+            for (size_t a = 0; a < m_n0[0]; a++) {
+                Cell cell;
+                cell.child = -1;
+                for (size_t m = 0; m < 8; m++) {
+                    cell.corner[m] = (m < nc) ?
+                        addPoint((a + (m & 1)) * s, (b + ((m >> 1) & 1)) * s,
+                                 (c + ((m >> 2) & 1)) * s) : -1;
+                }
+                active.push_back({m_cells.size(), a*s, b*s, c*s, s});
+                m_cells.push_back(cell);
+            }
+        }
+    }
+
+    try {
+        computePoints();
+        vector_fp Y(m_nsp);
+        size_t nw = (nd == 3) ? 3 : 1; // number of points in the P direction
+        while (!active.empty() && active[0].size > 1) {
+            // Add the midpoints of the edges and faces and the center of each
+            // cell, which are the additional corners of its children
+            size_t h = active[0].size / 2;
+            for (const auto& a : active) {
+                for (size_t w = 0; w < nw; w++) {
+                    for (size_t v = 0; v < 3; v++) {
+                        for (size_t u = 0; u < 3; u++) {
+                            addPoint(a.i + u*h, a.j + v*h, a.k + w*h);
+                        }
+                    }
+                }
+            }
+            computePoints();
+
+            // Refine cells where the interpolation error at any of the new
+            // points is too large
+            vector<Active> next;
+            for (const auto& a : active) {
+                bool refine = false;
+                for (size_t w = 0; w < nw && !refine; w++) {
+                    for (size_t v = 0; v < 3 && !refine; v++) {
+                        for (size_t u = 0; u < 3 && !refine; u++) {
+                            if (u != 1 && v != 1 && w != 1) {
+                                continue; // corner of the cell
+                            }
+                            int p = addPoint(a.i + u*h, a.j + v*h, a.k + w*h);
+                            double x[3] = {0.5*u, 0.5*v, 0.5*w};
+                            double T = interpolate(m_cells[a.cell], x, Y.data());
+                            refine = fabs(T - m_T[p]) > m_Ttol;
+                            for (size_t k = 0; k < m_nsp && !refine; k++) {
+                                refine = fabs(Y[k] - m_Y[p*m_nsp+k]) > m_Ytol;
+                            }
+                        }
+                    }
+                }
+                if (!refine) {
+                    continue;
+                }
+                m_cells[a.cell].child = static_cast<int>(m_cells.size());
+                for (size_t m = 0; m < nc; m++) {
+                    size_t i = a.i + (m & 1) * h;
+                    size_t j = a.j + ((m >> 1) & 1) * h;
+                    size_t k = a.k + ((m >> 2) & 1) * h;
+                    Cell cell;
+                    cell.child = -1;
+                    for (size_t q = 0; q < 8; q++) {
+                        cell.corner[q] = (q < nc) ?
+                            addPoint(i + (q & 1) * h, j + ((q >> 1) & 1) * h,
+                                     k + ((q >> 2) & 1) * h) : -1;
+                    }
+                    next.push_back({m_cells.size(), i, j, k, h});
+                    m_cells.push_back(cell);
+                }
+            }
+            active.swap(next);
+        }
+    } catch (...) {
+        m_cells.clear();
+        m_T.clear();
+        m_Y.clear();
+        m_pointIndex.clear();
+        throw;
+    }
+    m_pointIndex.clear();
+}
+
+double EquilibriumTable::interpolate(const Cell& cell, const double* x,
+                                     double* Y) const
+{
+    size_t nd = nDims();
+    double T = 0.0;
+    if (Y) {
+        std::fill(Y, Y + m_nsp, 0.0);
+    }
+    for (size_t m = 0; m < (size_t(1) << nd); m++) {
+        double w = 1.0;
+        for (size_t d = 0; d < nd; d++) {
+            w *= ((m >> d) & 1) ? x[d] : 1.0 - x[d];
+        }
+        size_t p = cell.corner[m];
+        T += w * m_T[p];
+        if (Y) {
+            const double* Yp = &m_Y[p * m_nsp];
+            for (size_t k = 0; k < m_nsp; k++) {
+                Y[k] += w * Yp[k];
+            }
+        }
+    }
+    return T;
+}
+
+double EquilibriumTable::lookup(double Z, double h, double P, double* Y) const
+{
+    if (!ready()) {
+        throw CanteraError("EquilibriumTable::lookup",
+                           "The table has not been built");
+    }
+    size_t nd = nDims();
+    double hlow = unreactedEnthalpy(Z, false);
+    double x[3];
+    x[0] = Z;
+    x[1] = (h - hlow) / (unreactedEnthalpy(Z, true) - hlow);
+    x[2] = (nd == 3) ? log(P / m_Pmin) / log(m_Pmax / m_Pmin) : 0.0;
+    size_t n0[3] = {m_n0[0], m_n0[1], (nd == 3) ? m_n0[2] : 1};
+
+    // Find the cell of the initial grid
+    size_t index[3];
+    for (size_t d = 0; d < nd; d++) {
+        // allow for round-off error at the boundaries
+        if (!(x[d] >= -1e-10 && x[d] <= 1.0 + 1e-10)) {
+            throw CanteraError("EquilibriumTable::lookup",
+                "State (Z = {}, h = {}, P = {}) is outside the range of "
+                "the table", Z, h, P);
+        }
+        x[d] = std::max(std::min(x[d], 1.0), 0.0);
+        x[d] *= n0[d];
+        index[d] = std::min(static_cast<size_t>(x[d]), n0[d] - 1);
+        x[d] -= index[d];
+    }
+    if (nd == 2) {
+        index[2] = 0;
+    }
+    const Cell* cell = &m_cells[index[0] + n0[0] * (index[1] + n0[1] * index[2])];
+
+    // Descend to the cell containing the state
+    while (cell->child >= 0) {
+        size_t m = 0;
+        for (size_t d = 0; d < nd; d++) {
+            if (x[d] >= 0.5) {
+                m |= size_t(1) << d;
+                x[d] = 2.0 * x[d] - 1.0;
+            } else {
+                x[d] *= 2.0;
+            }
+        }
+        cell = &m_cells[cell->child + m];
+    }
+    return interpolate(*cell, x, Y);
+}
+
+void EquilibriumTable::setState(ThermoPhase& phase, double Z, double h,
+                                double P) const
+{
+    if (phase.nSpecies() != m_nsp) {
+        throw CanteraError("EquilibriumTable::setState",
+            "Phase has {} species instead of {}", phase.nSpecies(), m_nsp);
+    }
+    vector_fp Y(m_nsp);
+    double T = lookup(Z, h, P, Y.data());
+    phase.setState_TPY(T, P, Y.data());
+}
+
+size_t EquilibriumTable::nCells() const
+{
+    size_t n = 0;
+    for (const auto& cell : m_cells) {
+        if (cell.child < 0) {
+            n++;
+        }
+    }
+    return n;
+}
+
+size_t EquilibriumTable::nFinestCells() const
+{
+    if (!ready()) {
+        return 0;
+    }
+    // Traverse the tree of cells level by level, starting from the cells of
+    // the initial grid
+    size_t nRoot = m_n0[0] * m_n0[1] * ((nDims() == 3) ? m_n0[2] : 1);
+    size_t nc = size_t(1) << nDims();
+    vector<size_t> level(nRoot);
+    std::iota(level.begin(), level.end(), 0);
+    for (size_t n = 0; n < m_maxLevel; n++) {
+        vector<size_t> next;
+        for (size_t i : level) {
+            if (m_cells[i].child >= 0) {
+                for (size_t m = 0; m < nc; m++) {
+                    next.push_back(m_cells[i].child + m);
+                }
+            }
+        }
+        level.swap(next);
+    }
+    return level.size();
+}
+
+void EquilibriumTable::save(const std::string& filename) const
+{
+    if (!ready()) {
+        throw CanteraError("EquilibriumTable::save",
+                           "The table has not been built");
+    }
+    XML_Node doc("doc");
+    XML_Node& root = doc.addChild("equilibriumTable");
+    root.addAttribute("version", "1");
+    std::string names;
+    for (size_t k = 0; k < m_nsp; k++) {
+        names += (k ? " " : "") + m_phase.speciesName(k);
+    }
+    root.addChild("speciesArray", names);
+    addFloat(root, "Tmin", m_Tmin, "K");
+    addFloat(root, "Tmax", m_Tmax, "K");
+    addFloat(root, "Pmin", m_Pmin, "Pa");
+    addFloat(root, "Pmax", m_Pmax, "Pa");
+    addFloat(root, "Ttol", m_Ttol, "K");
+    addFloat(root, "Ytol", m_Ytol);
+    addFloatArray(root, "hFuel", 2, m_hFuel, "J/kg");
+    addFloatArray(root, "hOxidizer", 2, m_hOx, "J/kg");
+    addFloatArray(root, "Yfuel", m_nsp, m_Yfuel.data());
+    addFloatArray(root, "Yoxidizer", m_nsp, m_Yox.data());
+    double grid[4] = {double(m_n0[0]), double(m_n0[1]), double(m_n0[2]),
+                      double(m_maxLevel)};
+    addFloatArray(root, "grid", 4, grid);
+    vector_fp cells;
+    cells.reserve(9 * m_cells.size());
+    for (const auto& cell : m_cells) {
+        cells.push_back(cell.child);
+        cells.insert(cells.end(), cell.corner, cell.corner + 8);
+    }
+    addFloatArray(root, "cells", cells.size(), cells.data());
+    addFloatArray(root, "T", m_T.size(), m_T.data(), "K");
+    addFloatArray(root, "Y", m_Y.size(), m_Y.data());
+
+    std::ofstream f(filename);
+    if (!f) {
+        throw CanteraError("EquilibriumTable::save",
+                           "Unable to open file '{}' for writing", filename);
+    }
+    root.writeHeader(f);
+    root.write(f);
+}
+
+void EquilibriumTable::load(const std::string& filename)
+{
+    XML_Node doc("doc");
+    doc.build(filename);
+    XML_Node* root = doc.findByName("equilibriumTable");
+    if (!root) {
+        throw CanteraError("EquilibriumTable::load",
+                           "File '{}' does not contain an equilibrium table",
+                           filename);
+    }
+    std::vector<std::string> names;
+    getStringArray(root->child("speciesArray"), names);
+    if (names != m_phase.speciesNames()) {
+        throw CanteraError("EquilibriumTable::load",
+                           "The species in file '{}' do not match those of "
+                           "phase '{}'", filename, m_phase.name());
+    }
+
+    auto getArray = [&](const std::string& title, size_t n, vector_fp& v) {
+        XML_Node* node = getByTitle(*root, title);
+        if (!node) {
+            throw CanteraError("EquilibriumTable::load",
+                               "Missing array '{}'", title);
+        }
+        getFloatArray(*node, v, false);
+        if (n != npos && v.size() != n) {
+            throw CanteraError("EquilibriumTable::load",
+                "Array '{}' has length {} instead of {}", title, v.size(), n);
+        }
+    };
+
+    // Read and check all of the data before modifying the table
+    vector_fp grid, hFuel, hOx, Yfuel, Yox, T, Y, v;
+    getArray("grid", 4, grid);
+    double Tmin = getFloat(*root, "Tmin");
+    double Tmax = getFloat(*root, "Tmax");
+    double Pmin = getFloat(*root, "Pmin");
+    double Pmax = getFloat(*root, "Pmax");
+    double Ttol = getFloat(*root, "Ttol");
+    double Ytol = getFloat(*root, "Ytol");
+    getArray("hFuel", 2, hFuel);
+    getArray("hOxidizer", 2, hOx);
+    getArray("Yfuel", m_nsp, Yfuel);
+    getArray("Yoxidizer", m_nsp, Yox);
+    getArray("T", npos, T);
+    getArray("Y", T.size() * m_nsp, Y);
+    getArray("cells", npos, v);
+    if (v.size() % 9) {
+        throw CanteraError("EquilibriumTable::load",
+                           "Array 'cells' has invalid length {}", v.size());
+    }
+
+    size_t nd = (Pmax > Pmin) ? 3 : 2;
+    size_t nc = size_t(1) << nd; // number of corners
+    size_t nCells = v.size() / 9;
+    double nRoot = 1.0;
+    for (size_t d = 0; d < nd; d++) {
+        if (!(grid[d] >= 1.0)) {
+            throw CanteraError("EquilibriumTable::load",
+                "Invalid number of cells {} in the initial grid", grid[d]);
+        }
+        nRoot *= grid[d];
+    }
+    if (nRoot > nCells) {
+        throw CanteraError("EquilibriumTable::load", "The initial grid has "
+            "{} cells, but only {} cells are defined", nRoot, nCells);
+    }
+
+    std::vector<Cell> cells(nCells);
+    for (size_t n = 0; n < nCells; n++) {
+        // The children of a cell are stored after it, which also guarantees
+        // that lookup() terminates
+        double child = v[9*n];
+        if (child != -1.0 && !(child > n && child + nc <= nCells)) {
+            throw CanteraError("EquilibriumTable::load",
+                "Cell {} has invalid child index {}", n, child);
+        }
+        cells[n].child = static_cast<int>(child);
+        for (size_t m = 0; m < 8; m++) {
+            double corner = v[9*n + m + 1];
+            if (m < nc && !(corner >= 0 && corner < T.size())) {
+                throw CanteraError("EquilibriumTable::load",
+                    "Corner {} of cell {} has invalid point index {}",
+                    m, n, corner);
+            }
+            cells[n].corner[m] = (m < nc) ? static_cast<int>(corner) : -1;
+        }
+    }
+
+    m_n0[0] = static_cast<size_t>(grid[0]);
+    m_n0[1] = static_cast<size_t>(grid[1]);
+    m_n0[2] = static_cast<size_t>(grid[2]);
+    m_maxLevel = static_cast<size_t>(grid[3]);
+    m_Tmin = Tmin;
+    m_Tmax = Tmax;
+    m_Pmin = Pmin;
+    m_Pmax = Pmax;
+    m_Ttol = Ttol;
+    m_Ytol = Ytol;
+    std::copy(hFuel.begin(), hFuel.end(), m_hFuel);
+    std::copy(hOx.begin(), hOx.end(), m_hOx);
+    m_Yfuel = std::move(Yfuel);
+    m_Yox = std::move(Yox);
+    m_T = std::move(T);
+    m_Y = std::move(Y);
+    m_cells = std::move(cells);
+}
+
+}
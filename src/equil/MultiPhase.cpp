@@ -350,11 +350,11 @@ void MultiPhase::setPhaseMoleFractions(const size_t n, const doublereal* const x
 void MultiPhase::setMolesByName(const compositionMap& xMap)
 {
     size_t kk = nSpecies();
-    vector_fp moles(kk, 0.0);
+    m_workMoles.resize(kk);
     for (size_t k = 0; k < kk; k++) {
-        moles[k] = std::max(getValue(xMap, speciesName(k), 0.0), 0.0);
+        m_workMoles[k] = std::max(getValue(xMap, speciesName(k), 0.0), 0.0);
     }
-    setMoles(moles.data());
+    setMoles(m_workMoles.data());
 }
 
 void MultiPhase::setMolesByName(const std::string& x)
@@ -411,11 +411,11 @@ void MultiPhase::setMoles(const doublereal* n)
 
 void MultiPhase::addSpeciesMoles(const int indexS, const doublereal addedMoles)
 {
-    vector_fp tmpMoles(m_nsp, 0.0);
-    getMoles(tmpMoles.data());
-    tmpMoles[indexS] += addedMoles;
-    tmpMoles[indexS] = std::max(tmpMoles[indexS], 0.0);
-    setMoles(tmpMoles.data());
+    m_workMoles.resize(m_nsp);
+    getMoles(m_workMoles.data());
+    m_workMoles[indexS] += addedMoles;
+    m_workMoles[indexS] = std::max(m_workMoles[indexS], 0.0);
+    setMoles(m_workMoles.data());
 }
 
 void MultiPhase::setState_TP(const doublereal T, const doublereal Pres)
@@ -486,6 +486,30 @@ double MultiPhase::equilibrate_MultiPhaseEquil(int XY, doublereal err,
         init();
     }
 
+    if (XY == HP || XY == SP || XY == UV) {
+        // Try Newton iteration first. If it fails, restore the initial state
+        // and use the more robust (but slower) iterations below.
+        vector_fp moleFractions0 = m_moleFractions;
+        vector_fp moles0 = m_moles;
+        double T0 = m_temp;
+        double P0 = m_press;
+        try {
+            return equilibrate_Newton(XY, err, maxsteps, maxiter, loglevel);
+        } catch (CanteraError& e) {
+            if (XY == UV) {
+                throw;
+            }
+            debuglog("Newton iteration failed; using bracketing iteration.\n",
+                     loglevel);
+            debuglog(e.what(), loglevel);
+            m_moleFractions = moleFractions0;
+            m_moles = moles0;
+            m_temp = T0;
+            m_press = P0;
+            updatePhases();
+        }
+    }
+
     if (XY == TP) {
         // create an equilibrium manager
         MultiPhaseEquil e(this);
@@ -637,6 +661,91 @@ double MultiPhase::equilibrate_MultiPhaseEquil(int XY, doublereal err,
     return -1.0;
 }
 
+double MultiPhase::equilibrate_Newton(int XY, doublereal err, int maxsteps,
+                                      int maxiter, int loglevel)
+{
+    double h0 = enthalpy();
+    double s0 = entropy();
+    double u0 = IntEnergy();
+    double v0 = volume();
+    double Tlow = 0.5*m_Tmin; // lower bound on T
+    double Thigh = 2.0*m_Tmax; // upper bound on T
+    double dT[3], dP[3];
+    bool start = false;
+    for (int n = 0; n < maxiter; n++) {
+        // if 'start' is false, the current composition is used as the
+        // starting estimate; otherwise it is estimated
+        try {
+            MultiPhaseEquil e(this, start);
+            e.equilibrate(TP, err, maxsteps, loglevel);
+            e.getEquilibriumDerivatives(dT, (XY == UV) ? dP : 0);
+        } catch (CanteraError&) {
+            if (!start) {
+                start = true;
+            } else if (XY == UV) {
+                throw;
+            } else {
+                // move toward the upper bound, where the fixed TP problem is
+                // usually easier to solve
+                setTemperature(0.5*(m_temp + Thigh));
+            }
+            continue;
+        }
+        start = false;
+
+        if (XY == HP || XY == SP) {
+            // the equilibrium enthalpy and entropy increase monotonically
+            // with T, so the sign of the residual brackets the solution
+            double r = (XY == HP) ? enthalpy() - h0 : entropy() - s0;
+            if (r < 0.0) {
+                Tlow = std::max(Tlow, m_temp);
+            } else {
+                Thigh = std::min(Thigh, m_temp);
+            }
+            double dt = -r / ((XY == HP) ? dT[0] : dT[1]);
+            if (XY == HP && (fabs(r) < err*fabs(h0) || fabs(dt) < err*m_temp)) {
+                return err;
+            } else if (XY == SP && fabs(dt) < 1.0e-4) {
+                return err;
+            }
+            double tnew = m_temp + dt;
+            if (!(tnew > Tlow && tnew < Thigh)) {
+                tnew = 0.5*(Tlow + Thigh);
+            }
+            setTemperature(tnew);
+        } else {
+            // U = H - PV, so dU/dT = dH/dT - P dV/dT and
+            // dU/dP = dH/dP - V - P dV/dP
+            double unow = IntEnergy();
+            double vnow = volume();
+            double a = dT[0] - m_press*dT[2];
+            double b = dP[0] - vnow - m_press*dP[2];
+            double c = dT[2];
+            double d = dP[2];
+            double det = a*d - b*c;
+            double ru = unow - u0;
+            double rv = vnow - v0;
+            double dt = (b*rv - d*ru) / det;
+            double dp = (c*ru - a*rv) / det;
+            if ((fabs(ru) < err*fabs(u0) || fabs(dt) < err*m_temp) &&
+                (fabs(rv) < err*v0 || fabs(dp) < err*m_press)) {
+                return err;
+            }
+            // limit the step so that T and P remain positive
+            double f = std::min(1.0, 0.5*m_temp/fabs(dt));
+            f = std::min(f, 0.8*m_press/fabs(dp));
+            if (!(f > 0.0)) {
+                throw CanteraError("MultiPhase::equilibrate_Newton",
+                                   "Singular Jacobian");
+            }
+            setTemperature(m_temp + f*dt);
+            setPressure(m_press + f*dp);
+        }
+    }
+    throw CanteraError("MultiPhase::equilibrate_Newton",
+                       "No convergence for T");
+}
+
 void MultiPhase::equilibrate(const std::string& XY, const std::string& solver,
                              double rtol, int max_steps, int max_iter,
                              int estimate_equil, int log_level)
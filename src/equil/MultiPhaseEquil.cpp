@@ -510,7 +510,7 @@ doublereal MultiPhaseEquil::stepComposition(int loglevel)
 
 doublereal MultiPhaseEquil::computeReactionSteps(vector_fp& dxi)
 {
-    vector_fp nu;
+    vector_fp& nu = m_nu;
     doublereal grad = 0.0;
     dxi.resize(nFree());
     computeN();
@@ -627,6 +627,121 @@ void MultiPhaseEquil::computeN()
     }
 }
 
+void MultiPhaseEquil::getEquilibriumDerivatives(double* dT, double* dP)
+{
+    double T = m_mix->temperature();
+    bool withVolume = (dP != 0);
+
+    // Partial molar properties of all species, and the derivatives of the
+    // volume and enthalpy of the mixture at constant composition
+    vector_fp hbar(m_nsp_mix), sbar(m_nsp_mix), vbar(m_nsp_mix, 0.0);
+    double dVdT = 0.0, dVdP = 0.0, dHdP = 0.0;
+    for (size_t ip = 0; ip < m_mix->nPhases(); ip++) {
+        ThermoPhase& p = m_mix->phase(ip);
+        size_t k0 = m_mix->speciesIndex(0, ip);
+        p.getPartialMolarEnthalpies(&hbar[k0]);
+        p.getPartialMolarEntropies(&sbar[k0]);
+        if (withVolume) {
+            p.getPartialMolarVolumes(&vbar[k0]);
+            double V = m_mix->phaseMoles(ip) / p.molarDensity();
+            double alpha = p.thermalExpansionCoeff();
+            dVdT += V * alpha;
+            dVdP -= V * p.isothermalCompressibility();
+            dHdP += V * (1.0 - T * alpha);
+        }
+    }
+
+    // Formation reactions which can shift: all except those of stoichiometric
+    // phase species which are not present
+    vector<vector_fp> nu;
+    vector_fp dh, ds, dv;
+    for (size_t j = 0; j < nFree(); j++) {
+        size_t k = m_order[j + m_nel];
+        if (!m_dsoln[k] && m_mix->speciesMoles(m_species[k]) <= 0.0) {
+            continue;
+        }
+        nu.emplace_back();
+        getStoichVector(j, nu.back());
+        dh.push_back(0.0);
+        ds.push_back(0.0);
+        dv.push_back(0.0);
+        for (k = 0; k < m_nsp; k++) {
+            dh.back() += nu.back()[k] * hbar[m_species[k]];
+            ds.back() += nu.back()[k] * sbar[m_species[k]];
+            dv.back() += nu.back()[k] * vbar[m_species[k]];
+        }
+    }
+    size_t nr = nu.size();
+
+    // Hessian of the Gibbs function with respect to the reaction extents,
+    // divided by RT
+    DenseMatrix G(nr, nr, 0.0);
+    for (size_t k = 0; k < m_nsp; k++) {
+        if (m_dsoln[k]) {
+            double nk = fabs(m_mix->speciesMoles(m_species[k])) + Tiny;
+            for (size_t a = 0; a < nr; a++) {
+                if (nu[a][k] == 0.0) {
+                    continue;
+                }
+                for (size_t b = 0; b < nr; b++) {
+                    G(a,b) += nu[a][k] * nu[b][k] / nk;
+                }
+            }
+        }
+    }
+    vector_fp psi(nr);
+    for (size_t ip = 0; ip < m_mix->nPhases(); ip++) {
+        if (m_mix->phase(ip).nSpecies() < 2) {
+            continue;
+        }
+        for (size_t a = 0; a < nr; a++) {
+            psi[a] = 0.0;
+            for (size_t k = 0; k < m_nsp; k++) {
+                if (m_mix->speciesPhaseIndex(m_species[k]) == ip) {
+                    psi[a] += nu[a][k];
+                }
+            }
+        }
+        double np = fabs(m_mix->phaseMoles(ip)) + Tiny;
+        for (size_t a = 0; a < nr; a++) {
+            for (size_t b = 0; b < nr; b++) {
+                G(a,b) -= psi[a] * psi[b] / np;
+            }
+        }
+    }
+
+    // Changes in the reaction extents with T and P, from the derivatives of
+    // Delta mu / RT for each reaction
+    vector_fp dxi(2*nr);
+    for (size_t a = 0; a < nr; a++) {
+        dxi[a] = ds[a] / (GasConstant * T);
+        dxi[nr + a] = -dv[a] / (GasConstant * T);
+    }
+    if (nr) {
+        solve(G, dxi.data(), 2, nr);
+    }
+
+    double cp = m_mix->cp();
+    dT[0] = cp;
+    dT[1] = cp / T;
+    for (size_t a = 0; a < nr; a++) {
+        dT[0] += dh[a] * dxi[a];
+        dT[1] += ds[a] * dxi[a];
+    }
+    if (withVolume) {
+        dT[2] = dVdT;
+        dP[0] = dHdP;
+        dP[1] = -dVdT;
+        dP[2] = dVdP;
+        for (size_t a = 0; a < nr; a++) {
+            dT[2] += dv[a] * dxi[a];
+            dP[0] += dh[a] * dxi[nr + a];
+            dP[1] += ds[a] * dxi[nr + a];
+            dP[2] += dv[a] * dxi[nr + a];
+        }
+    }
+}
+
 doublereal MultiPhaseEquil::error()
 {
     doublereal err, maxerr = 0.0;
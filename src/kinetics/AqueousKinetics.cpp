@@ -70,6 +70,7 @@ void AqueousKinetics::updateKc()
 
 void AqueousKinetics::getEquilibriumConstants(doublereal* kc)
 {
+    checkNotEditing("AqueousKinetics::getEquilibriumConstants");
     _update_rates_T();
 
     thermo().getStandardChemPotentials(m_grt.data());
@@ -94,6 +95,7 @@ void AqueousKinetics::getEquilibriumConstants(doublereal* kc)
 
 void AqueousKinetics::updateROP()
 {
+    checkNotEditing("AqueousKinetics::updateROP");
     _update_rates_T();
     _update_rates_C();
 
@@ -129,6 +131,7 @@ void AqueousKinetics::updateROP()
 
 void AqueousKinetics::getFwdRateConstants(doublereal* kfwd)
 {
+    checkNotEditing("AqueousKinetics::getFwdRateConstants");
     _update_rates_T();
     _update_rates_C();
 
@@ -146,8 +149,8 @@ void AqueousKinetics::getFwdRateConstants(doublereal* kfwd)
 bool AqueousKinetics::addReaction(shared_ptr<Reaction> r)
 {
     bool added = BulkKinetics::addReaction(r);
-    if (!added) {
-        return false;
+    if (!added || m_editing) {
+        return added;
     }
     if (r->reaction_type == ELEMENTARY_RXN) {
         addElementaryReaction(dynamic_cast<ElementaryReaction&>(*r));
@@ -161,6 +164,9 @@ bool AqueousKinetics::addReaction(shared_ptr<Reaction> r)
 void AqueousKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
 {
     BulkKinetics::modifyReaction(i, rNew);
+    if (editDeferred(i)) {
+        return;
+    }
     modifyElementaryReaction(i, dynamic_cast<ElementaryReaction&>(*rNew));
 
     // invalidate all cached data
@@ -0,0 +1,146 @@
+/**
+ *  @file BatchSurfaceSolver.cpp
+ *  Definitions for solving many independent pseudo-steady state surface
+ *  problems (see \ref kineticsmgr and class
+ *  \link Cantera::BatchSurfaceSolver BatchSurfaceSolver\endlink).
+ */
+
+#include "cantera/kinetics/BatchSurfaceSolver.h"
+#include "cantera/kinetics/ImplicitSurfChem.h"
+#include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/SurfPhase.h"
+
+#include <thread>
+
+using namespace std;
+
+namespace Cantera
+{
+
+struct BatchSurfaceSolver::Worker
+{
+    vector<unique_ptr<ThermoPhase>> phases;
+    unique_ptr<InterfaceKinetics> kin;
+    unique_ptr<ImplicitSurfChem> surfChem;
+    SurfPhase* surf;
+};
+
+BatchSurfaceSolver::BatchSurfaceSolver(InterfaceKinetics& kin, size_t nThreads) :
+    m_kin(kin),
+    m_surfIndex(kin.surfacePhaseIndex()),
+    m_warmStart(false)
+{
+    if (m_surfIndex == npos) {
+        throw CanteraError("BatchSurfaceSolver::BatchSurfaceSolver",
+                           "Kinetics manager contains no surface phase");
+    }
+    if (m_surfIndex == 0) {
+        throw CanteraError("BatchSurfaceSolver::BatchSurfaceSolver",
+                           "The first phase of the kinetics manager must not "
+                           "be the surface phase");
+    }
+    if (nThreads == 0) {
+        nThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    for (size_t i = 0; i < nThreads; i++) {
+        unique_ptr<Worker> w(new Worker());
+        vector<ThermoPhase*> phases;
+        for (size_t n = 0; n < kin.nPhases(); n++) {
+            const XML_Node& phaseNode = kin.thermo(n).xml();
+            if (!phaseNode.hasChild("thermo")) {
+                throw CanteraError("BatchSurfaceSolver::BatchSurfaceSolver",
+                    "Phase '{}' was not created from an input file",
+                    kin.thermo(n).name());
+            }
+            w->phases.emplace_back(newPhase(phaseNode));
+            phases.push_back(w->phases.back().get());
+        }
+        Kinetics* k = newKineticsMgr(phases[m_surfIndex]->xml(), phases);
+        w->kin.reset(dynamic_cast<InterfaceKinetics*>(k));
+        if (!w->kin) {
+            delete k;
+            throw CanteraError("BatchSurfaceSolver::BatchSurfaceSolver",
+                               "Unable to create a copy of the kinetics manager");
+        }
+        for (size_t r = 0; r < std::min(kin.nReactions(),
+                                        k->nReactions()); r++) {
+            k->setMultiplier(r, kin.multiplier(r));
+        }
+
+        // The copies are created from the input files, so changes made to the
+        // reactions of the original kinetics manager would be lost
+        for (size_t n = 0; n < kin.nPhases(); n++) {
+            w->phases[n]->copyStateFrom(kin.thermo(n));
+            w->phases[n]->setElectricPotential(
+                kin.thermo(n).electricPotential());
+        }
+        checkKineticsCopy(kin, *w->kin,
+                          "BatchSurfaceSolver::BatchSurfaceSolver");
+        w->surf = &dynamic_cast<SurfPhase&>(w->kin->thermo(m_surfIndex));
+        w->surfChem.reset(new ImplicitSurfChem({w->kin.get()}));
+        m_workers.push_back(std::move(w));
+    }
+    m_threads.reset(new WorkerThreads(nThreads));
+}
+
+BatchSurfaceSolver::~BatchSurfaceSolver()
+{
+}
+
+void BatchSurfaceSolver::solve(size_t n, const double* T, const double* P,
+                               const double* X, double* coverages,
+                               double* sdot)
+{
+    // Synchronize the states of the phases other than the first phase and
+    // the surface with the original kinetics manager
+    vector_fp state;
+    for (size_t p = 1; p < m_kin.nPhases(); p++) {
+        if (p == m_surfIndex) {
+            continue;
+        }
+        m_kin.thermo(p).saveState(state);
+        double phi = m_kin.thermo(p).electricPotential();
+        for (auto& w : m_workers) {
+            w->phases[p]->restoreState(state);
+            w->phases[p]->setElectricPotential(phi);
+        }
+    }
+    for (auto& w : m_workers) {
+        w->phases[0]->setElectricPotential(m_kin.thermo(0).electricPotential());
+        w->surf->setElectricPotential(m_kin.thermo(m_surfIndex).electricPotential());
+    }
+
+    // Divide the problems into contiguous blocks
+    size_t nw = std::min(m_workers.size(), n);
+    m_threads->run(nw, [&](size_t i) {
+        solveBlock(*m_workers[i], (i * n) / nw, ((i + 1) * n) / nw, T, P, X,
+                   coverages, sdot);
+    });
+}
+
+void BatchSurfaceSolver::solveBlock(Worker& w, size_t i0, size_t i1,
+                                    const double* T, const double* P,
+                                    const double* X, double* coverages,
+                                    double* sdot)
+{
+    ThermoPhase& gas = *w.phases[0];
+    size_t nGas = gas.nSpecies();
+    size_t nSurf = w.surf->nSpecies();
+    size_t nTot = w.kin->nTotalSpecies();
+    for (size_t i = i0; i < i1; i++) {
+        gas.setState_TPX(T[i], P[i], X + i*nGas);
+        w.surf->setState_TP(T[i], P[i]);
+        if (!m_warmStart || i == i0) {
+            w.surf->setCoverages(coverages + i*nSurf);
+        }
+        w.surfChem->solvePseudoSteadyStateProblem();
+        w.surf->getCoverages(coverages + i*nSurf);
+        if (sdot) {
+            w.kin->getNetProductionRates(sdot + i*nTot);
+        }
+    }
+}
+
+}
@@ -106,8 +106,8 @@ void BulkKinetics::getRevRateConstants(doublereal* krev, bool doIrreversible)
 bool BulkKinetics::addReaction(shared_ptr<Reaction> r)
 {
     bool added = Kinetics::addReaction(r);
-    if (!added) {
-        return false;
+    if (!added || m_editing) {
+        return added;
     }
     double dn = 0.0;
     for (const auto& sp : r->products) {
@@ -149,6 +149,57 @@ void BulkKinetics::setMultiplier(size_t i, double f) {
     m_ROP_ok = false;
 }
 
+void BulkKinetics::setArrheniusParameters(size_t i, double A, double b,
+                                          double Ea_R)
+{
+    checkEditState("BulkKinetics::setArrheniusParameters", i);
+    Arrhenius* rate = arrheniusRate(i);
+    if (!rate) {
+        throw CanteraError("BulkKinetics::setArrheniusParameters", "Reaction "
+            "{} does not have a single Arrhenius rate expression", i);
+    }
+    rate->setParameters(A, b, Ea_R);
+    invalidateCache();
+}
+
+void BulkKinetics::setArrheniusParameters(const double* A, const double* b,
+                                          const double* Ea_R)
+{
+    checkEditState("BulkKinetics::setArrheniusParameters");
+    for (size_t i = 0; i < nReactions(); i++) {
+        Arrhenius* rate = arrheniusRate(i);
+        if (rate && !std::isnan(A[i]) && !std::isnan(b[i]) &&
+            !std::isnan(Ea_R[i])) {
+            rate->setParameters(A[i], b[i], Ea_R[i]);
+        }
+    }
+    invalidateCache();
+}
+
+void BulkKinetics::getArrheniusParameters(double* A, double* b, double* Ea_R)
+{
+    checkEditState("BulkKinetics::getArrheniusParameters");
+    for (size_t i = 0; i < nReactions(); i++) {
+        Arrhenius* rate = arrheniusRate(i);
+        if (rate) {
+            A[i] = rate->preExponentialFactor();
+            b[i] = rate->temperatureExponent();
+            Ea_R[i] = rate->activationEnergy_R();
+        } else {
+            A[i] = b[i] = Ea_R[i] = NAN;
+        }
+    }
+}
+
+void BulkKinetics::clearReactionData()
+{
+    Kinetics::clearReactionData();
+    m_rates = Rate1<Arrhenius>();
+    m_revindex.clear();
+    m_irrev.clear();
+    m_dn.clear();
+}
+
 void BulkKinetics::invalidateCache()
 {
     Kinetics::invalidateCache();
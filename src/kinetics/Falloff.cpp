@@ -39,6 +39,8 @@ void Troe::init(const vector_fp& c)
     }
     if (c.size() == 4) {
         m_t2 = c[3];
+    } else {
+        m_t2 = 0.0;
     }
 }
 
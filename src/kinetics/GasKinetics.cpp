@@ -45,11 +45,17 @@ void GasKinetics::update_rates_T()
         if (!falloff_work.empty()) {
             m_falloffn.updateTemp(T, falloff_work.data());
         }
-        updateKc();
         m_ROP_ok = false;
     }
 
     if (T != m_temp || P != m_pres) {
+        // The standard chemical potentials and concentrations depend on the
+        // pressure, so the equilibrium constants are recomputed whenever
+        // either variable changes. Otherwise, their round-off error would
+        // depend on the pressure at which the temperature last changed.
+        updateKc();
+        m_ROP_ok = false;
+
         if (m_plog_rates.nReactions()) {
             m_plog_rates.update(T, logT, m_rfn.data());
             m_ROP_ok = false;
@@ -116,6 +122,7 @@ void GasKinetics::updateKc()
 
 void GasKinetics::getEquilibriumConstants(doublereal* kc)
 {
+    checkNotEditing("GasKinetics::getEquilibriumConstants");
     update_rates_T();
     thermo().getStandardChemPotentials(m_grt.data());
     fill(m_rkcn.begin(), m_rkcn.end(), 0.0);
@@ -160,6 +167,7 @@ void GasKinetics::processFalloffReactions()
 
 void GasKinetics::updateROP()
 {
+    checkNotEditing("GasKinetics::updateROP");
     update_rates_C();
     update_rates_T();
     if (m_ROP_ok) {
@@ -211,6 +219,7 @@ void GasKinetics::updateROP()
 
 void GasKinetics::getFwdRateConstants(doublereal* kfwd)
 {
+    checkNotEditing("GasKinetics::getFwdRateConstants");
     update_rates_C();
     update_rates_T();
 
@@ -238,8 +247,8 @@ bool GasKinetics::addReaction(shared_ptr<Reaction> r)
 {
     // operations common to all reaction types
     bool added = BulkKinetics::addReaction(r);
-    if (!added) {
-        return false;
+    if (!added || m_editing) {
+        return added;
     }
 
     switch (r->reaction_type) {
@@ -334,6 +343,9 @@ void GasKinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
 {
     // operations common to all reaction types
     BulkKinetics::modifyReaction(i, rNew);
+    if (editDeferred(i)) {
+        return;
+    }
 
     switch (rNew->reaction_type) {
     case ELEMENTARY_RXN:
@@ -392,6 +404,84 @@ void GasKinetics::init()
     m_logp_ref = log(thermo().refPressure()) - log(GasConstant);
 }
 
+Arrhenius* GasKinetics::arrheniusRate(size_t i)
+{
+    auto iter = m_rfallindx.find(i);
+    if (iter != m_rfallindx.end()) {
+        return m_falloff_high_rates.rate(iter->second);
+    }
+    return m_rates.rate(i);
+}
+
+void GasKinetics::setLowPressureArrheniusParameters(size_t i, double A,
+                                                    double b, double Ea_R)
+{
+    checkEditState("GasKinetics::setLowPressureArrheniusParameters", i);
+    auto iter = m_rfallindx.find(i);
+    if (iter == m_rfallindx.end()) {
+        throw CanteraError("GasKinetics::setLowPressureArrheniusParameters",
+            "Reaction {} is not a falloff or chemically activated reaction", i);
+    }
+    m_falloff_low_rates.rate(iter->second)->setParameters(A, b, Ea_R);
+    invalidateCache();
+}
+
+void GasKinetics::setFalloffParameters(size_t i, const vector_fp& c)
+{
+    checkEditState("GasKinetics::setFalloffParameters", i);
+    auto iter = m_rfallindx.find(i);
+    if (iter == m_rfallindx.end()) {
+        throw CanteraError("GasKinetics::setFalloffParameters",
+            "Reaction {} is not a falloff or chemically activated reaction", i);
+    }
+    m_falloffn.setParameters(iter->second, c);
+    invalidateCache();
+}
+
+void GasKinetics::setPlogParameters(size_t i, size_t j, double A, double b,
+                                    double Ea_R)
+{
+    checkEditState("GasKinetics::setPlogParameters", i);
+    Plog* rate = m_plog_rates.rate(i);
+    if (!rate) {
+        throw CanteraError("GasKinetics::setPlogParameters",
+                           "Reaction {} is not a P-log reaction", i);
+    }
+    rate->setRate(j, Arrhenius(A, b, Ea_R));
+    invalidateCache();
+}
+
+void GasKinetics::setChebyshevCoeffs(size_t i, const double* coeffs)
+{
+    checkEditState("GasKinetics::setChebyshevCoeffs", i);
+    ChebyshevRate* rate = m_cheb_rates.rate(i);
+    if (!rate) {
+        throw CanteraError("GasKinetics::setChebyshevCoeffs",
+                           "Reaction {} is not a Chebyshev reaction", i);
+    }
+    rate->setCoeffs(coeffs);
+    invalidateCache();
+}
+
+void GasKinetics::clearReactionData()
+{
+    BulkKinetics::clearReactionData();
+    m_fallindx.clear();
+    m_rfallindx.clear();
+    m_falloff_low_rates = Rate1<Arrhenius>();
+    m_falloff_high_rates = Rate1<Arrhenius>();
+    m_falloffn = FalloffMgr();
+    m_3b_concm = ThirdBodyCalc();
+    m_falloff_concm = ThirdBodyCalc();
+    m_plog_rates = Rate1<Plog>();
+    m_cheb_rates = Rate1<ChebyshevRate>();
+    m_rfn_low.clear();
+    m_rfn_high.clear();
+    falloff_work.clear();
+    concm_3b_values.clear();
+    concm_falloff_values.clear();
+}
+
 void GasKinetics::invalidateCache()
 {
     BulkKinetics::invalidateCache();
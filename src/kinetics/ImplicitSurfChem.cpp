@@ -25,6 +25,7 @@ ImplicitSurfChem::ImplicitSurfChem(vector<InterfaceKinetics*> k) :
     m_mediumSpeciesStart(-1),
     m_bulkSpeciesStart(-1),
     m_surfSpeciesStart(-1),
+    m_jacThreads(1),
     m_commonTempPressForPhases(true),
     m_ioFlag(0)
 {
@@ -70,14 +71,6 @@ ImplicitSurfChem::ImplicitSurfChem(vector<InterfaceKinetics*> k) :
     m_numTotalSpecies = m_nv + m_numTotalBulkSpecies;
     m_concSpecies.resize(m_numTotalSpecies, 0.0);
     m_concSpeciesSave.resize(m_numTotalSpecies, 0.0);
-
-    m_integ.reset(newIntegrator("CVODE"));
-
-    // use backward differencing, with a full Jacobian computed
-    // numerically, and use a Newton linear iterator
-    m_integ->setMethod(BDF_Method);
-    m_integ->setProblemType(DENSE + NOJAC);
-    m_integ->setIterator(Newton_Iter);
     m_work.resize(ntmax);
 }
 
@@ -112,12 +105,27 @@ void ImplicitSurfChem::getState(doublereal* c)
 
 void ImplicitSurfChem::initialize(doublereal t0)
 {
+    // The integrator is only needed for time-accurate integration, so it is
+    // not created for objects that are only used for pseudo-steady state
+    // solves.
+    if (!m_integ) {
+        m_integ.reset(newIntegrator("CVODE"));
+
+        // use backward differencing, with a full Jacobian computed
+        // numerically, and use a Newton linear iterator
+        m_integ->setMethod(BDF_Method);
+        m_integ->setProblemType(DENSE + NOJAC);
+        m_integ->setIterator(Newton_Iter);
+    }
     m_integ->setTolerances(m_rtol, m_atol);
     m_integ->initialize(t0, *this);
 }
 
 void ImplicitSurfChem::integrate(doublereal t0, doublereal t1)
 {
+    if (!m_integ) {
+        initialize(t0);
+    }
     m_integ->initialize(t0, *this);
     m_integ->setMaxStepSize(t1 - t0);
     m_integ->integrate(t1);
@@ -126,6 +134,9 @@ void ImplicitSurfChem::integrate(doublereal t0, doublereal t1)
 
 void ImplicitSurfChem::integrate0(doublereal t0, doublereal t1)
 {
+    if (!m_integ) {
+        initialize(t0);
+    }
     m_integ->integrate(t1);
     updateState(m_integ->solution());
 }
@@ -158,6 +169,14 @@ void ImplicitSurfChem::eval(doublereal time, doublereal* y,
     }
 }
 
+void ImplicitSurfChem::setJacobianThreads(size_t nThreads)
+{
+    m_jacThreads = nThreads;
+    if (m_surfSolver) {
+        m_surfSolver->setJacobianThreads(nThreads);
+    }
+}
+
 void ImplicitSurfChem::solvePseudoSteadyStateProblem(int ifuncOverride,
         doublereal timeScaleOverride)
 {
@@ -167,7 +186,11 @@ void ImplicitSurfChem::solvePseudoSteadyStateProblem(int ifuncOverride,
     // time scale - time over which to integrate equations
     doublereal time_scale = timeScaleOverride;
     if (!m_surfSolver) {
-        m_surfSolver.reset(new solveSP(this, bulkFunc));
+        unique_ptr<solveSP> solver(new solveSP(this, bulkFunc));
+        if (m_jacThreads != 1) {
+            solver->setJacobianThreads(m_jacThreads);
+        }
+        m_surfSolver = std::move(solver);
         // set ifunc, which sets the algorithm.
         ifunc = SFLUX_INITIALIZE;
     } else {
@@ -18,6 +18,9 @@ namespace Cantera
 
 InterfaceKinetics::InterfaceKinetics(thermo_t* thermo) :
     m_redo_rates(false),
+    m_redo_phi(false),
+    m_siteDensity(0.0),
+    m_covStateNum(-1),
     m_surf(0),
     m_integrator(0),
     m_ROP_ok(false),
@@ -59,6 +62,13 @@ InterfaceKinetics& InterfaceKinetics::operator=(const InterfaceKinetics& right)
     m_revindex = right.m_revindex;
     m_rates = right.m_rates;
     m_redo_rates = right.m_redo_rates;
+    m_redo_phi = right.m_redo_phi;
+    m_phaseTemp = right.m_phaseTemp;
+    m_phasePres = right.m_phasePres;
+    m_siteDensity = right.m_siteDensity;
+    m_covStateNum = right.m_covStateNum;
+    m_rfnBase = right.m_rfnBase;
+    m_covDependentRxns = right.m_covDependentRxns;
     m_irrev = right.m_irrev;
     m_conc = right.m_conc;
     m_actConc = right.m_actConc;
@@ -66,7 +76,6 @@ InterfaceKinetics& InterfaceKinetics::operator=(const InterfaceKinetics& right)
     m_mu = right.m_mu;
     m_mu0_Kc = right.m_mu0_Kc;
     m_phi = right.m_phi;
-    m_pot = right.m_pot;
     deltaElectricEnergy_ = right.deltaElectricEnergy_;
     m_surf = right.m_surf; //DANGER - shallow copy
     m_integrator = right.m_integrator; //DANGER - shallow copy
@@ -74,6 +83,10 @@ InterfaceKinetics& InterfaceKinetics::operator=(const InterfaceKinetics& right)
     m_ctrxn = right.m_ctrxn;
     m_ctrxn_BVform = right.m_ctrxn_BVform;
     m_ctrxn_ecdf = right.m_ctrxn_ecdf;
+    m_ctrxn_dq = right.m_ctrxn_dq;
+    m_ctrxn_betaKf = right.m_ctrxn_betaKf;
+    m_ctrxn_ecdfConv = right.m_ctrxn_ecdfConv;
+    m_ctrxn_ecdfSign = right.m_ctrxn_ecdfSign;
     m_StandardConc = right.m_StandardConc;
     m_deltaG0 = right.m_deltaG0;
     m_deltaG = right.m_deltaG;
@@ -111,27 +124,62 @@ Kinetics* InterfaceKinetics::duplMyselfAsKinetics(const std::vector<thermo_t*> &
 void InterfaceKinetics::setElectricPotential(int n, doublereal V)
 {
     thermo(n).setElectricPotential(V);
-    m_redo_rates = true;
+    m_redo_phi = true;
 }
 
 void InterfaceKinetics::_update_rates_T()
 {
     // First task is update the electrical potentials from the Phases
     _update_rates_phi();
-    if (m_has_coverage_dependence) {
-        m_surf->getCoverages(m_actConc.data());
-        m_rates.update_C(m_actConc.data());
-        m_redo_rates = true;
+
+    // The standard chemical potentials and standard concentrations used in
+    // the equilibrium constants depend on the temperature and pressure of
+    // each phase, and on the surface site density.
+    const thermo_t& surf = thermo(surfacePhaseIndex());
+    doublereal T = surf.temperature();
+    bool redoBase = m_redo_rates || T != m_temp;
+    bool redoKc = redoBase || m_redo_phi;
+    for (size_t n = 0; n < nPhases(); n++) {
+        doublereal Tn = thermo(n).temperature();
+        doublereal Pn = thermo(n).pressure();
+        if (Tn != m_phaseTemp[n] || Pn != m_phasePres[n]) {
+            m_phaseTemp[n] = Tn;
+            m_phasePres[n] = Pn;
+            redoKc = true;
+        }
+    }
+    if (surf.standardConcentration() != m_siteDensity) {
+        m_siteDensity = surf.standardConcentration();
+        redoKc = true;
     }
 
-    // Go find the temperature from the surface
-    doublereal T = thermo(surfacePhaseIndex()).temperature();
-    m_redo_rates = true;
-    if (T != m_temp || m_redo_rates) {
+    // The temperature dependent parts of the rate constants are recomputed
+    // only when the temperature may have changed, and the coverage
+    // dependent parts only for the reactions that have them and only when
+    // the surface composition has changed.
+    bool redoCov = false;
+    if (m_has_coverage_dependence &&
+        (m_redo_rates || m_surf->stateMFNumber() != m_covStateNum)) {
+        m_covStateNum = m_surf->stateMFNumber();
+        m_surf->getCoverages(m_actConc.data());
+        for (size_t i : m_covDependentRxns) {
+            m_rates.update_C(i, m_actConc.data());
+        }
+        redoCov = true;
+    }
+    if (redoBase) {
         m_logtemp = log(T);
+        m_rates.updateBase(T, m_logtemp, m_rfnBase.data());
+    }
 
-        //  Calculate the forward rate constant by calling m_rates and store it in m_rfn[]
-        m_rates.update(T, m_logtemp, m_rfn.data());
+    if (redoKc || redoCov) {
+        //  Combine the cached temperature dependent parts with the coverage
+        //  dependent modifiers to obtain the forward rate constants, m_rfn[]
+        m_rfn = m_rfnBase;
+        doublereal recipT = 1.0 / T;
+        for (size_t i : m_covDependentRxns) {
+            m_rfn[i] *= m_rates.coverageFactor(i, recipT);
+        }
         applyStickingCorrection(T, m_rfn.data());
 
         // If we need to do conversions between exchange current density
@@ -142,11 +190,15 @@ void InterfaceKinetics::_update_rates_T()
         if (m_has_electrochem_rxns) {
             applyVoltageKfwdCorrection(m_rfn.data());
         }
+        m_ROP_ok = false;
+    }
+    if (redoKc) {
         m_temp = T;
         updateKc();
         m_ROP_ok = false;
-        m_redo_rates = false;
     }
+    m_redo_rates = false;
+    m_redo_phi = false;
 }
 
 void InterfaceKinetics::_update_rates_phi()
@@ -155,7 +207,7 @@ void InterfaceKinetics::_update_rates_phi()
     for (size_t n = 0; n < nPhases(); n++) {
         if (thermo(n).electricPotential() != m_phi[n]) {
             m_phi[n] = thermo(n).electricPotential();
-            m_redo_rates = true;
+            m_redo_phi = true;
         }
     }
 }
@@ -271,6 +323,7 @@ void InterfaceKinetics::checkPartialEquil()
 
 void InterfaceKinetics::getEquilibriumConstants(doublereal* kc)
 {
+    checkNotEditing("InterfaceKinetics::getEquilibriumConstants");
     updateMu0();
     doublereal rrt = 1.0 / thermo(0).RT();
     std::fill(kc, kc + nReactions(), 0.0);
@@ -314,82 +367,92 @@ void InterfaceKinetics::updateExchangeCurrentQuantities()
 
 void InterfaceKinetics::applyVoltageKfwdCorrection(doublereal* const kf)
 {
-    // Compute the electrical potential energy of each species
-    size_t ik = 0;
-    for (size_t n = 0; n < nPhases(); n++) {
-        size_t nsp = thermo(n).nSpecies();
-        for (size_t k = 0; k < nsp; k++) {
-            m_pot[ik] = Faraday * thermo(n).charge(k) * m_phi[n];
-            ik++;
-        }
-    }
-
-    // Compute the change in electrical potential energy for each reaction. This
-    // will only be non-zero if a potential difference is present.
-    getReactionDelta(m_pot.data(), deltaElectricEnergy_.data());
-
-    // Modify the reaction rates. Only modify those with a non-zero activation
-    // energy. Below we decrease the activation energy below zero but in some
-    // debug modes we print out a warning message about this.
+    // Modify the reaction rates. Below we decrease the activation energy below
+    // zero but in some debug modes we print out a warning message about this.
 
     // NOTE, there is some discussion about this point. Should we decrease the
     // activation energy below zero? I don't think this has been decided in any
     // definitive way. The treatment below is numerically more stable, however.
-    for (size_t i = 0; i < m_beta.size(); i++) {
+    doublereal rrt = 1.0 / thermo(0).RT();
+    for (size_t i = 0; i < m_ctrxn.size(); i++) {
         size_t irxn = m_ctrxn[i];
 
-        // If we calculate the BV form directly, we don't add the voltage
-        // correction to the forward reaction rate constants.
-        if (m_ctrxn_BVform[i] == 0) {
-            double eamod = m_beta[i] * deltaElectricEnergy_[irxn];
-            if (eamod != 0.0) {
-                kf[irxn] *= exp(-eamod/thermo(0).RT());
-            }
+        // Compute the change in electrical potential energy for the reaction
+        // from the net charge transferred into each phase. This will only be
+        // non-zero if a potential difference is present.
+        const vector_fp& dq = m_ctrxn_dq[i];
+        doublereal dE = 0.0;
+        for (size_t n = 0; n < dq.size(); n++) {
+            dE += dq[n] * m_phi[n];
         }
+        deltaElectricEnergy_[irxn] = Faraday * dE;
+
+        // If we calculate the BV form directly, m_ctrxn_betaKf is zero and the
+        // voltage correction is not added to the forward rate constant.
+        kf[irxn] *= exp(-m_ctrxn_betaKf[i] * deltaElectricEnergy_[irxn] * rrt);
     }
 }
 
 void InterfaceKinetics::convertExchangeCurrentDensityFormulation(doublereal* const kfwd)
 {
     updateExchangeCurrentQuantities();
-    // Loop over all reactions which are defined to have a voltage transfer
-    // coefficient that affects the activity energy for the reaction
+    doublereal rrt = 1.0 / thermo(0).RT();
+
+    // Loop over the charge transfer reactions for which the formulation of the
+    // rate constant (exchange current density or chemical rate constant)
+    // differs from the one used to evaluate the reaction rate. For a rate
+    // constant given as an exchange current density which is evaluated in the
+    // standard form (sign = +1), we need the straight chemical reaction rate
+    // constant to come out of this calculation. For a chemical rate constant
+    // which is evaluated in the BV form directly (sign = -1), we calculate the
+    // exchange current density formulation and substitute it.
+    for (size_t j = 0; j < m_ctrxn_ecdfConv.size(); j++) {
+        size_t i = m_ctrxn_ecdfConv[j];
+        size_t irxn = m_ctrxn[i];
+        doublereal sign = m_ctrxn_ecdfSign[j];
+        kfwd[irxn] *= exp(-sign * m_beta[i] * m_deltaG0[irxn] * rrt) *
+                      pow(Faraday * m_ProdStanConcReac[irxn], -sign);
+    }
+}
+
+void InterfaceKinetics::getNetRatesOfProgress_ddPhi(size_t n, doublereal* drop)
+{
+    checkPhaseIndex(n);
+    updateROP();
+    std::fill(drop, drop + nReactions(), 0.0);
+    doublereal frt = Faraday / thermo(0).RT();
     for (size_t i = 0; i < m_ctrxn.size(); i++) {
         size_t irxn = m_ctrxn[i];
+        doublereal beta = m_ctrxn_betaKf[i];
+        drop[irxn] = - frt * m_ctrxn_dq[i][n] *
+            (beta * m_ropf[irxn] + (1.0 - beta) * m_ropr[irxn]);
+    }
+}
 
-        // Determine whether the reaction rate constant is in an exchange
-        // current density formulation format.
-        int iECDFormulation = m_ctrxn_ecdf[i];
-        if (iECDFormulation) {
-            // If the BV form is to be converted into the normal form then we go
-            // through this process. If it isn't to be converted, then we don't
-            // go through this process.
-            //
-            // We need to have the straight chemical reaction rate constant to
-            // come out of this calculation.
-            if (m_ctrxn_BVform[i] == 0) {
-                //  Calculate the term and modify the forward reaction
-                double tmp = exp(- m_beta[i] * m_deltaG0[irxn] / thermo(0).RT());
-                tmp *= 1.0 / m_ProdStanConcReac[irxn] / Faraday;
-                kfwd[irxn] *= tmp;
-            }
-            //  If BVform is nonzero we don't need to do anything.
-        } else {
-            // kfwd[] is the chemical reaction rate constant
-            //
-            // If we are to calculate the BV form directly, then we will do the
-            // reverse. We will calculate the exchange current density
-            // formulation here and substitute it.
-            if (m_ctrxn_BVform[i] != 0) {
-                // Calculate the term and modify the forward reaction rate
-                // constant so that it's in the exchange current density
-                // formulation format
-                double tmp = exp(m_beta[i] * m_deltaG0[irxn] * thermo(0).RT());
-                tmp *= Faraday * m_ProdStanConcReac[irxn];
-                kfwd[irxn] *= tmp;
-            }
-        }
+doublereal InterfaceKinetics::currentDensity(size_t n)
+{
+    checkPhaseIndex(n);
+    updateROP();
+    doublereal q = 0.0;
+    for (size_t i = 0; i < m_ctrxn.size(); i++) {
+        q += m_ctrxn_dq[i][n] * m_ropnet[m_ctrxn[i]];
     }
+    return Faraday * q;
+}
+
+doublereal InterfaceKinetics::currentDensity_ddPhi(size_t n, size_t m)
+{
+    checkPhaseIndex(n);
+    checkPhaseIndex(m);
+    updateROP();
+    doublereal dq = 0.0;
+    for (size_t i = 0; i < m_ctrxn.size(); i++) {
+        size_t irxn = m_ctrxn[i];
+        doublereal beta = m_ctrxn_betaKf[i];
+        dq -= m_ctrxn_dq[i][n] * m_ctrxn_dq[i][m] *
+            (beta * m_ropf[irxn] + (1.0 - beta) * m_ropr[irxn]);
+    }
+    return Faraday * Faraday / thermo(0).RT() * dq;
 }
 
 void InterfaceKinetics::getFwdRateConstants(doublereal* kfwd)
@@ -418,6 +481,7 @@ void InterfaceKinetics::getRevRateConstants(doublereal* krev, bool doIrreversibl
 
 void InterfaceKinetics::updateROP()
 {
+    checkNotEditing("InterfaceKinetics::updateROP");
     // evaluate rate constants and equilibrium constants at temperature and phi
     // (electric potential)
     _update_rates_T();
@@ -605,17 +669,20 @@ bool InterfaceKinetics::addReaction(shared_ptr<Reaction> r_base)
 {
     size_t i = nReactions();
     bool added = Kinetics::addReaction(r_base);
-    if (!added) {
-        return false;
+    if (!added || m_editing) {
+        return added;
     }
 
     InterfaceReaction& r = dynamic_cast<InterfaceReaction&>(*r_base);
     SurfaceArrhenius rate = buildSurfaceArrhenius(i, r, false);
     m_rates.install(i, rate);
+    m_rfnBase.push_back(0.0);
+    m_redo_rates = true;
 
     // Turn on the global flag indicating surface coverage dependence
-    if (!r.coverage_deps.empty()) {
+    if (rate.coverageDependent()) {
         m_has_coverage_dependence = true;
+        m_covDependentRxns.push_back(i);
     }
 
     ElectrochemicalReaction* re = dynamic_cast<ElectrochemicalReaction*>(&r);
@@ -656,6 +723,28 @@ bool InterfaceKinetics::addReaction(shared_ptr<Reaction> r_base)
                                    "film resistivity set for elementary reaction");
             }
         }
+
+        // Precompute the quantities used to apply the potential dependence
+        // and the exchange current density conversion without branching on
+        // the reaction type.
+        vector_fp dq(nPhases(), 0.0);
+        for (const auto& sp : r.reactants) {
+            size_t k = kineticsSpeciesIndex(sp.first);
+            size_t p = speciesPhaseIndex(k);
+            dq[p] -= sp.second * thermo(p).charge(k - m_start[p]);
+        }
+        for (const auto& sp : r.products) {
+            size_t k = kineticsSpeciesIndex(sp.first);
+            size_t p = speciesPhaseIndex(k);
+            dq[p] += sp.second * thermo(p).charge(k - m_start[p]);
+        }
+        m_ctrxn_dq.push_back(dq);
+        bool bvForm = (m_ctrxn_BVform.back() != 0);
+        m_ctrxn_betaKf.push_back(bvForm ? 0.0 : re->beta);
+        if (re->exchange_current_density_formulation != bvForm) {
+            m_ctrxn_ecdfConv.push_back(m_ctrxn.size() - 1);
+            m_ctrxn_ecdfSign.push_back(bvForm ? -1.0 : 1.0);
+        }
     }
 
     if (r.reversible) {
@@ -689,15 +778,87 @@ bool InterfaceKinetics::addReaction(shared_ptr<Reaction> r_base)
 void InterfaceKinetics::modifyReaction(size_t i, shared_ptr<Reaction> r_base)
 {
     Kinetics::modifyReaction(i, r_base);
+    if (editDeferred(i)) {
+        return;
+    }
     InterfaceReaction& r = dynamic_cast<InterfaceReaction&>(*r_base);
     SurfaceArrhenius rate = buildSurfaceArrhenius(i, r, true);
     m_rates.replace(i, rate);
 
+    auto iter = std::find(m_covDependentRxns.begin(),
+                          m_covDependentRxns.end(), i);
+    if (rate.coverageDependent() && iter == m_covDependentRxns.end()) {
+        m_has_coverage_dependence = true;
+        m_covDependentRxns.insert(std::upper_bound(m_covDependentRxns.begin(),
+                                  m_covDependentRxns.end(), i), i);
+    } else if (!rate.coverageDependent() && iter != m_covDependentRxns.end()) {
+        m_covDependentRxns.erase(iter);
+    }
+
     // Invalidate cached data
     m_redo_rates = true;
     m_temp += 0.1;
 }
 
+void InterfaceKinetics::setArrheniusParameters(size_t i, double A, double b,
+                                               double Ea_R)
+{
+    checkEditState("InterfaceKinetics::setArrheniusParameters", i);
+    m_rates.rate(i)->setParameters(A, b, Ea_R);
+    m_redo_rates = true;
+}
+
+void InterfaceKinetics::setArrheniusParameters(const double* A,
+                                               const double* b,
+                                               const double* Ea_R)
+{
+    checkEditState("InterfaceKinetics::setArrheniusParameters");
+    for (size_t i = 0; i < nReactions(); i++) {
+        if (!std::isnan(A[i]) && !std::isnan(b[i]) && !std::isnan(Ea_R[i])) {
+            m_rates.rate(i)->setParameters(A[i], b[i], Ea_R[i]);
+        }
+    }
+    m_redo_rates = true;
+}
+
+void InterfaceKinetics::getArrheniusParameters(double* A, double* b,
+                                               double* Ea_R)
+{
+    checkEditState("InterfaceKinetics::getArrheniusParameters");
+    for (size_t i = 0; i < nReactions(); i++) {
+        m_rates.rate(i)->getParameters(A[i], b[i], Ea_R[i]);
+    }
+}
+
+void InterfaceKinetics::clearReactionData()
+{
+    Kinetics::clearReactionData();
+    m_rates = Rate1<SurfaceArrhenius>();
+    m_rfnBase.clear();
+    m_redo_rates = true;
+    m_has_coverage_dependence = false;
+    m_covDependentRxns.clear();
+    m_has_electrochem_rxns = false;
+    m_has_exchange_current_density_formulation = false;
+    m_beta.clear();
+    m_ctrxn.clear();
+    m_ctrxn_ecdf.clear();
+    m_ctrxn_BVform.clear();
+    m_ctrxn_dq.clear();
+    m_ctrxn_betaKf.clear();
+    m_ctrxn_ecdfConv.clear();
+    m_ctrxn_ecdfSign.clear();
+    m_revindex.clear();
+    m_irrev.clear();
+    m_rxnPhaseIsReactant.clear();
+    m_rxnPhaseIsProduct.clear();
+    deltaElectricEnergy_.clear();
+    m_deltaG0.clear();
+    m_deltaG.clear();
+    m_ProdStanConcReac.clear();
+    m_stickingData.clear();
+}
+
 SurfaceArrhenius InterfaceKinetics::buildSurfaceArrhenius(
     size_t i, InterfaceReaction& r, bool replace)
 {
@@ -783,7 +944,11 @@ SurfaceArrhenius InterfaceKinetics::buildSurfaceArrhenius(
                           r.rate.temperatureExponent(),
                           r.rate.activationEnergy_R());
 
-    // Set up coverage dependencies
+    // Set up coverage dependencies. The coverages are read from #m_surf,
+    // which is not set if the phases were added without calling init().
+    if (!r.coverage_deps.empty() && !m_surf) {
+        init();
+    }
     for (const auto& sp : r.coverage_deps) {
         size_t k = thermo(reactionPhaseIndex()).speciesIndex(sp.first);
         rate.addCoverageDependence(k, sp.second.a, sp.second.m, sp.second.E);
@@ -836,8 +1001,13 @@ void InterfaceKinetics::resizeSpecies()
     m_mu.resize(m_kk);
     m_mu0_Kc.resize(m_kk);
     m_grt.resize(m_kk);
-    m_pot.resize(m_kk, 0.0);
     m_phi.resize(nPhases(), 0.0);
+    for (auto& dq : m_ctrxn_dq) {
+        dq.resize(nPhases(), 0.0);
+    }
+    m_phaseTemp.resize(nPhases(), 0.0);
+    m_phasePres.resize(nPhases(), 0.0);
+    m_redo_rates = true;
 }
 
 doublereal InterfaceKinetics::electrochem_beta(size_t irxn) const
@@ -865,11 +1035,11 @@ void InterfaceKinetics::advanceCoverages(doublereal tstep)
 void InterfaceKinetics::solvePseudoSteadyStateProblem(
     int ifuncOverride, doublereal timeScaleOverride)
 {
-    // create our own solver object
+    // create our own solver object. The time integrator is not needed for
+    // the pseudo-steady state solve, so it is not initialized here.
     if (m_integrator == 0) {
         vector<InterfaceKinetics*> k{this};
         m_integrator = new ImplicitSurfChem(k);
-        m_integrator->initialize();
     }
     m_integrator->setIOFlag(m_ioFlag);
     // New direct method to go here
@@ -22,7 +22,10 @@ Kinetics::Kinetics() :
     m_rxnphase(npos),
     m_mindim(4),
     m_skipUndeclaredSpecies(false),
-    m_skipUndeclaredThirdBodies(false)
+    m_skipUndeclaredThirdBodies(false),
+    m_editing(false),
+    m_editRebuild(false),
+    m_editBuilt(0)
 {
 }
 
@@ -65,6 +68,9 @@ Kinetics& Kinetics::operator=(const Kinetics& right)
     m_ropr = right.m_ropr;
     m_ropnet = right.m_ropnet;
     m_skipUndeclaredSpecies = right.m_skipUndeclaredSpecies;
+    m_editing = right.m_editing;
+    m_editRebuild = right.m_editRebuild;
+    m_editBuilt = right.m_editBuilt;
 
     return *this;
 }
@@ -561,6 +567,12 @@ bool Kinetics::addReaction(shared_ptr<Reaction> r)
     }
 
     checkReactionBalance(*r);
+    if (m_editing) {
+        // The remaining data is created by commitEdit()
+        m_reactions.push_back(r);
+        m_perturb.push_back(1.0);
+        return true;
+    }
     size_t irxn = nReactions(); // index of the new reaction
 
     // indices of reactant and product species within this Kinetics object
@@ -644,6 +656,142 @@ void Kinetics::modifyReaction(size_t i, shared_ptr<Reaction> rNew)
     invalidateCache();
 }
 
+void Kinetics::setArrheniusParameters(size_t i, double A, double b,
+                                      double Ea_R)
+{
+    throw NotImplementedError("Kinetics::setArrheniusParameters");
+}
+
+void Kinetics::setArrheniusParameters(const double* A, const double* b,
+                                      const double* Ea_R)
+{
+    throw NotImplementedError("Kinetics::setArrheniusParameters");
+}
+
+void Kinetics::getArrheniusParameters(double* A, double* b,
+                                      double* Ea_R)
+{
+    throw NotImplementedError("Kinetics::getArrheniusParameters");
+}
+
+void Kinetics::setLowPressureArrheniusParameters(size_t i, double A,
+                                                 double b, double Ea_R)
+{
+    throw NotImplementedError("Kinetics::setLowPressureArrheniusParameters");
+}
+
+void Kinetics::setFalloffParameters(size_t i, const vector_fp& c)
+{
+    throw NotImplementedError("Kinetics::setFalloffParameters");
+}
+
+void Kinetics::setPlogParameters(size_t i, size_t j, double A, double b,
+                                 double Ea_R)
+{
+    throw NotImplementedError("Kinetics::setPlogParameters");
+}
+
+void Kinetics::setChebyshevCoeffs(size_t i, const double* coeffs)
+{
+    throw NotImplementedError("Kinetics::setChebyshevCoeffs");
+}
+
+void Kinetics::checkEditState(const std::string& func, size_t i) const
+{
+    if (i == npos) {
+        if (m_editing) {
+            throw CanteraError(func, "Not allowed while an edit of the "
+                               "mechanism is in progress");
+        }
+        return;
+    }
+    checkReactionIndex(i);
+    if (editDeferred(i)) {
+        throw CanteraError(func, "Reaction {} has been added, or an earlier "
+            "reaction has been removed, by the edit in progress", i);
+    }
+}
+
+void Kinetics::removeReaction(size_t i)
+{
+    checkReactionIndex(i);
+    if (!m_editing) {
+        beginEdit();
+        removeReaction(i);
+        commitEdit();
+        return;
+    }
+    m_reactions.erase(m_reactions.begin() + i);
+    m_perturb.erase(m_perturb.begin() + i);
+    m_editRebuild = true;
+}
+
+void Kinetics::beginEdit()
+{
+    if (m_editing) {
+        throw CanteraError("Kinetics::beginEdit",
+                           "An edit of the mechanism is already in progress");
+    }
+    m_editing = true;
+    m_editRebuild = false;
+    m_editBuilt = nReactions();
+}
+
+void Kinetics::commitEdit()
+{
+    if (!m_editing) {
+        throw CanteraError("Kinetics::commitEdit",
+                           "No edit of the mechanism is in progress");
+    }
+    size_t start = m_editRebuild ? 0 : m_editBuilt;
+    std::vector<shared_ptr<Reaction> > reactions = m_reactions;
+    vector_fp perturb = m_perturb;
+
+    m_editing = false;
+    if (m_editRebuild) {
+        clearReactionData();
+    } else {
+        m_reactions.resize(start);
+        m_perturb.resize(start);
+    }
+    try {
+        for (size_t j = start; j < reactions.size(); j++) {
+            size_t i = nReactions();
+            if (addReaction(reactions[j])) {
+                m_perturb[i] = perturb[j];
+            }
+        }
+    } catch (...) {
+        // Leave the edit in progress so that the invalid reactions can be
+        // removed. If the data for the existing reactions was kept, restore
+        // it. Otherwise, it is rebuilt by the next call to commitEdit().
+        clearReactionData();
+        for (size_t j = 0; j < start; j++) {
+            addReaction(reactions[j]);
+        }
+        m_reactions = reactions;
+        m_perturb = perturb;
+        m_editing = true;
+        throw;
+    }
+    m_editRebuild = false;
+    invalidateCache();
+}
+
+void Kinetics::clearReactionData()
+{
+    m_reactions.clear();
+    m_reactantStoich = StoichManagerN();
+    m_revProductStoich = StoichManagerN();
+    m_irrevProductStoich = StoichManagerN();
+    m_rfn.clear();
+    m_rkcn.clear();
+    m_ropf.clear();
+    m_ropr.clear();
+    m_ropnet.clear();
+    m_perturb.clear();
+}
+
 shared_ptr<Reaction> Kinetics::reaction(size_t i)
 {
     checkReactionIndex(i);
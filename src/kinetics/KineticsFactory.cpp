@@ -19,7 +19,7 @@ namespace Cantera
 KineticsFactory* KineticsFactory::s_factory = 0;
 std::mutex KineticsFactory::kinetics_mutex;
 
-Kinetics* KineticsFactory::newKinetics(XML_Node& phaseData,
+Kinetics* KineticsFactory::newKinetics(const XML_Node& phaseData,
                                        vector<ThermoPhase*> th)
 {
     // Look for a child of the XML element phase called "kinetics". It has an
@@ -50,4 +50,31 @@ Kinetics* KineticsFactory::newKinetics(const string& model)
     return create(lowercase(model));
 }
 
+void checkKineticsCopy(Kinetics& kin, Kinetics& copy,
+                       const std::string& procedure)
+{
+    size_t nr = kin.nReactions();
+    if (copy.nReactions() != nr) {
+        throw CanteraError(procedure,
+            "Copy of the kinetics manager has {} reactions instead of {}. "
+            "Kinetics managers which have been modified can not be copied.",
+            copy.nReactions(), nr);
+    }
+    vector_fp kf(nr), kfCopy(nr), kr(nr), krCopy(nr);
+    kin.getFwdRateConstants(kf.data());
+    copy.getFwdRateConstants(kfCopy.data());
+    kin.getRevRateConstants(kr.data());
+    copy.getRevRateConstants(krCopy.data());
+    for (size_t i = 0; i < nr; i++) {
+        if (kin.reactionString(i) != copy.reactionString(i)
+            || std::abs(kf[i] - kfCopy[i]) > 1e-12 * std::abs(kf[i])
+            || std::abs(kr[i] - krCopy[i]) > 1e-12 * std::abs(kr[i])) {
+            throw CanteraError(procedure,
+                "Reaction {} ({}) differs from its definition in the input "
+                "file. Kinetics managers which have been modified can not be "
+                "copied.", i, kin.reactionString(i));
+        }
+    }
+}
+
 }
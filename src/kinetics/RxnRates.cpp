@@ -25,6 +25,18 @@ Arrhenius::Arrhenius(doublereal A, doublereal b, doublereal E)
     }
 }
 
+void Arrhenius::setParameters(double A, double b, double E)
+{
+    m_A = A;
+    m_b = b;
+    m_E = E;
+    if (m_A <= 0.0) {
+        m_logA = -1.0E300;
+    } else {
+        m_logA = std::log(m_A);
+    }
+}
+
 SurfaceArrhenius::SurfaceArrhenius()
     : m_b(0.0)
     , m_E(0.0)
@@ -121,6 +133,14 @@ std::vector<std::pair<double, Arrhenius> > Plog::rates() const
 }
 
 
+void Plog::setRate(size_t j, const Arrhenius& rate)
+{
+    if (j >= rates_.size()) {
+        throw IndexError("Plog::setRate", "rates_", j, rates_.size()-1);
+    }
+    rates_[j] = rate;
+}
+
 ChebyshevRate::ChebyshevRate(double Tmin, double Tmax, double Pmin, double Pmax,
                              const Array2D& coeffs)
     : Tmin_(Tmin)
@@ -11,14 +11,29 @@
 #include "cantera/kinetics/solveSP.h"
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/kinetics/ImplicitSurfChem.h"
+#include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+#include <thread>
 
 using namespace std;
 namespace Cantera
 {
 
+struct solveSP::JacobianWorker
+{
+    //! Phases of the original surface problem, in the same order as #phases
+    vector<ThermoPhase*> original;
+    vector<unique_ptr<ThermoPhase>> phases;
+    vector<unique_ptr<InterfaceKinetics>> kin;
+    unique_ptr<ImplicitSurfChem> surfChem;
+    unique_ptr<solveSP> solver;
+};
+
 // STATIC ROUTINES DEFINED IN THIS FILE
 
-static doublereal calc_damping(doublereal* x, doublereal* dx, size_t dim, int*);
+static doublereal calc_damping(doublereal* x, doublereal* dx, size_t dim, int*,
+                               doublereal& damp_old);
 static doublereal calcWeightedNorm(const doublereal [], const doublereal dx[], size_t);
 
 // solveSP Class Definitions
@@ -36,6 +51,7 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
     m_rtol(1.0E-4),
     m_maxstep(1000),
     m_maxTotSpecies(0),
+    m_dampOld(1.0),
     m_ioflag(0)
 {
     m_numSurfPhases = 0;
@@ -113,6 +129,76 @@ solveSP::solveSP(ImplicitSurfChem* surfChemPtr, int bulkFunc) :
     m_Jac.resize(dim1, dim1, 0.0);
 }
 
+solveSP::~solveSP()
+{
+}
+
+void solveSP::setJacobianThreads(size_t nThreads)
+{
+    if (nThreads == 0) {
+        nThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    m_jacWorkers.resize(std::min(m_jacWorkers.size(), nThreads - 1));
+    while (m_jacWorkers.size() < nThreads - 1) {
+        unique_ptr<JacobianWorker> w(new JacobianWorker());
+        vector<InterfaceKinetics*> kinCopies;
+        for (size_t i = 0; i < m_objects.size(); i++) {
+            InterfaceKinetics& kin = *m_objects[i];
+            // Phases shared between kinetics objects are only copied once
+            vector<ThermoPhase*> phases;
+            for (size_t n = 0; n < kin.nPhases(); n++) {
+                ThermoPhase* orig = &kin.thermo(n);
+                size_t j = find(w->original.begin(), w->original.end(), orig)
+                           - w->original.begin();
+                if (j == w->original.size()) {
+                    const XML_Node& phaseNode = orig->xml();
+                    if (!phaseNode.hasChild("thermo")) {
+                        throw CanteraError("solveSP::setJacobianThreads",
+                            "Phase '{}' was not created from an input file",
+                            orig->name());
+                    }
+                    w->original.push_back(orig);
+                    w->phases.emplace_back(newPhase(phaseNode));
+                }
+                phases.push_back(w->phases[j].get());
+            }
+            Kinetics* k = newKineticsMgr(
+                phases[kin.surfacePhaseIndex()]->xml(), phases);
+            w->kin.emplace_back(dynamic_cast<InterfaceKinetics*>(k));
+            if (!w->kin.back()) {
+                delete k;
+                throw CanteraError("solveSP::setJacobianThreads",
+                                   "Unable to create a copy of the kinetics manager");
+            }
+            for (size_t r = 0; r < std::min(kin.nReactions(),
+                                            k->nReactions()); r++) {
+                k->setMultiplier(r, kin.multiplier(r));
+            }
+            kinCopies.push_back(w->kin.back().get());
+        }
+
+        // The copies are created from the input files, so changes made to
+        // the rate parameters of the original kinetics managers would be lost
+        for (size_t n = 0; n < w->phases.size(); n++) {
+            w->phases[n]->copyStateFrom(*w->original[n]);
+            w->phases[n]->setElectricPotential(
+                w->original[n]->electricPotential());
+        }
+        for (size_t i = 0; i < m_objects.size(); i++) {
+            checkKineticsCopy(*m_objects[i], *kinCopies[i],
+                              "solveSP::setJacobianThreads");
+        }
+        w->surfChem.reset(new ImplicitSurfChem(kinCopies));
+        w->solver.reset(new solveSP(w->surfChem.get(), m_bulkFunc));
+        m_jacWorkers.push_back(std::move(w));
+    }
+    if (nThreads == 1) {
+        m_jacThreads.reset();
+    } else if (!m_jacThreads || m_jacThreads->nThreads() != nThreads) {
+        m_jacThreads.reset(new WorkerThreads(nThreads));
+    }
+}
+
 int solveSP::solveSurfProb(int ifunc, doublereal time_scale, doublereal TKelvin,
                            doublereal PGas, doublereal reltol, doublereal abstol)
 {
@@ -228,7 +314,8 @@ int solveSP::solveSurfProb(int ifunc, doublereal time_scale, doublereal TKelvin,
 
         // Calculate the Damping factor needed to keep all unknowns between 0
         // and 1, and not allow too large a change (factor of 2) in any unknown.
-        damp = calc_damping(m_CSolnSP.data(), m_resid.data(), m_neq, &label_d);
+        damp = calc_damping(m_CSolnSP.data(), m_resid.data(), m_neq, &label_d,
+                            m_dampOld);
 
         // Calculate the weighted norm of the update vector Here, resid is the
         // delta of the solution, in concentration units.
@@ -450,26 +537,17 @@ void solveSP::resjac_eval(DenseMatrix& jac,
                           const doublereal CSolnOld[], const bool do_time,
                           const doublereal deltaT)
 {
-    size_t kColIndex = 0;
     // Calculate the residual
     fun_eval(resid, CSoln, CSolnOld, do_time, deltaT);
     // Now we will look over the columns perturbing each unknown.
-    for (size_t jsp = 0; jsp < m_numSurfPhases; jsp++) {
-        size_t nsp = m_nSpeciesSurfPhase[jsp];
-        double sd = m_ptrsSurfPhase[jsp]->siteDensity();
-        for (size_t kCol = 0; kCol < nsp; kCol++) {
-            double cSave = CSoln[kColIndex];
-            double dc = std::max(1.0E-10 * sd, fabs(cSave) * 1.0E-7);
-            CSoln[kColIndex] += dc;
-            fun_eval(m_numEqn2.data(), CSoln, CSolnOld, do_time, deltaT);
-            for (size_t i = 0; i < m_neq; i++) {
-                jac(i, kColIndex) = (m_numEqn2[i] - resid[i])/dc;
-            }
-            CSoln[kColIndex] = cSave;
-            kColIndex++;
-        }
+    if (m_jacWorkers.empty()) {
+        evalJacColumns(jac, resid, CSoln, CSolnOld, do_time, deltaT,
+                       0, m_numTotSurfSpecies);
+    } else {
+        evalJacColumnsParallel(jac, resid, CSoln, CSolnOld, do_time, deltaT);
     }
 
+    size_t kColIndex = m_numTotSurfSpecies;
     if (m_bulkFunc == BULK_DEPOSITION) {
         for (size_t jsp = 0; jsp < m_numBulkPhasesSS; jsp++) {
             size_t nsp = m_numBulkSpecies[jsp];
@@ -489,6 +567,57 @@ void solveSP::resjac_eval(DenseMatrix& jac,
     }
 }
 
+void solveSP::evalJacColumns(DenseMatrix& jac, const doublereal* resid,
+                             doublereal* CSoln, const doublereal* CSolnOld,
+                             bool do_time, doublereal deltaT,
+                             size_t c0, size_t c1)
+{
+    for (size_t kCol = c0; kCol < c1; kCol++) {
+        double sd = m_ptrsSurfPhase[m_kinObjIndex[kCol]]->siteDensity();
+        double cSave = CSoln[kCol];
+        double dc = std::max(1.0E-10 * sd, fabs(cSave) * 1.0E-7);
+        CSoln[kCol] += dc;
+        fun_eval(m_numEqn2.data(), CSoln, CSolnOld, do_time, deltaT);
+        for (size_t i = 0; i < m_neq; i++) {
+            jac(i, kCol) = (m_numEqn2[i] - resid[i])/dc;
+        }
+        CSoln[kCol] = cSave;
+    }
+}
+
+void solveSP::evalJacColumnsParallel(DenseMatrix& jac, const doublereal* resid,
+                                     doublereal* CSoln,
+                                     const doublereal* CSolnOld,
+                                     bool do_time, doublereal deltaT)
+{
+    // Synchronize the copies with the current state of the original phases
+    for (auto& w : m_jacWorkers) {
+        for (size_t n = 0; n < w->phases.size(); n++) {
+            w->phases[n]->copyStateFrom(*w->original[n]);
+            w->phases[n]->setElectricPotential(
+                w->original[n]->electricPotential());
+        }
+        w->solver->m_spSurfLarge = m_spSurfLarge;
+        copy(CSoln, CSoln + m_neq, w->solver->m_CSolnSave.begin());
+    }
+
+    // Divide the columns into contiguous blocks. The first block is evaluated
+    // on the calling thread.
+    size_t n = m_numTotSurfSpecies;
+    size_t nw = m_jacWorkers.size() + 1;
+    m_jacThreads->run(nw, [&](size_t i) {
+        size_t i0 = (i * n) / nw;
+        size_t i1 = ((i + 1) * n) / nw;
+        if (i == 0) {
+            evalJacColumns(jac, resid, CSoln, CSolnOld, do_time, deltaT, i0, i1);
+        } else {
+            solveSP* s = m_jacWorkers[i-1]->solver.get();
+            s->evalJacColumns(jac, resid, s->m_CSolnSave.data(), CSolnOld,
+                              do_time, deltaT, i0, i1);
+        }
+    });
+}
+
 /*!
  * This function calculates a damping factor for the Newton iteration update
  * vector, dxneg, to insure that all site and bulk fractions, x, remain
@@ -500,11 +629,11 @@ void solveSP::resjac_eval(DenseMatrix& jac,
  * that the step can take.  If the full step would not force any fraction
  * outside of 0-1, then Newton's method is allowed to operate normally.
  */
-static doublereal calc_damping(doublereal x[], doublereal dxneg[], size_t dim, int* label)
+static doublereal calc_damping(doublereal x[], doublereal dxneg[], size_t dim,
+                               int* label, doublereal& damp_old)
 {
     const doublereal APPROACH = 0.80;
     doublereal damp = 1.0;
-    static doublereal damp_old = 1.0; //! @todo this variable breaks thread safety
     *label = -1;
 
     for (size_t i = 0; i < dim; i++) {
@@ -3,6 +3,7 @@
 // Copyright 2001  California Institute of Technology
 #include "cantera/numerics/CVodesIntegrator.h"
 #include "cantera/base/stringUtils.h"
+#include "cantera/base/Array.h"
 
 #include <iostream>
 using namespace std;
@@ -61,6 +62,39 @@ extern "C" {
         return 0; // successful evaluation
     }
 
+    /**
+     * Function called by cvodes to evaluate the dense Jacobian if the problem
+     * type is DENSE + JAC. The Jacobian is evaluated by
+     * FuncEval::evalJacobian() and copied column by column into the matrix
+     * used by cvodes.
+     */
+    static int cvodes_jac(sd_size_t N, realtype t, N_Vector y, N_Vector fy,
+                          DlsMat Jac, void* f_data, N_Vector tmp1,
+                          N_Vector tmp2, N_Vector tmp3)
+    {
+        try {
+            FuncEval* f = (FuncEval*) f_data;
+            size_t n = static_cast<size_t>(N);
+            Array2D J(n, n);
+            f->evalJacobian(t, NV_DATA_S(y), NV_DATA_S(tmp1),
+                            f->m_sens_params.data(), &J);
+            for (size_t j = 0; j < n; j++) {
+                std::copy(J.ptrColumn(j), J.ptrColumn(j) + n, Jac->cols[j]);
+            }
+        } catch (CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        } catch (std::exception& err) {
+            std::cerr << "cvodes_jac: unhandled exception:" << std::endl;
+            std::cerr << err.what() << std::endl;
+            return -1; // unrecoverable error
+        } catch (...) {
+            std::cerr << "cvodes_jac: unhandled exception of unknown type" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0; // successful evaluation
+    }
+
     //! Function called by CVodes when an error is encountered instead of
     //! writing to stdout. Here, save the error message provided by CVodes so
     //! that it can be included in the subsequently raised CanteraError.
@@ -342,13 +376,16 @@ void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
 
 void CVodesIntegrator::applyOptions()
 {
-    if (m_type == DENSE + NOJAC) {
+    if (m_type == DENSE + NOJAC || m_type == DENSE + JAC) {
         sd_size_t N = static_cast<sd_size_t>(m_neq);
         #if SUNDIALS_USE_LAPACK
             CVLapackDense(m_cvode_mem, N);
         #else
             CVDense(m_cvode_mem, N);
         #endif
+        if (m_type == DENSE + JAC) {
+            CVDlsSetDenseJacFn(m_cvode_mem, cvodes_jac);
+        }
     } else if (m_type == DIAG) {
         CVDiag(m_cvode_mem);
     } else if (m_type == GMRES) {
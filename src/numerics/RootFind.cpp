@@ -11,6 +11,8 @@
 #include "cantera/base/utilities.h"
 #include "cantera/base/stringUtils.h"
 
+#include <atomic>
+
 using namespace std;
 namespace Cantera
 {
@@ -168,7 +170,7 @@ int RootFind::solve(doublereal xmin, doublereal xmax, int itmax, doublereal& fun
     // functional, func = eval(x1) -  m_funcTargetValue = 0
     m_funcTargetValue = funcTargetValue;
 
-    static int callNum = 0;
+    static std::atomic<int> callNum(0);
     const char* stre = "RootFind ERROR: ";
     const char* strw = "RootFind WARNING: ";
     int converged = 0;
@@ -196,9 +198,9 @@ int RootFind::solve(doublereal xmin, doublereal xmax, int itmax, doublereal& fun
     rfT.clear();
     rfT.reasoning = "First Point: ";
 
-    callNum++;
+    int iCall = ++callNum;
     if (printLvl >= 3 && writeLogAllowed_) {
-        fp = fopen(fmt::format("RootFind_%d.log", callNum).c_str(), "w");
+        fp = fopen(fmt::format("RootFind_%d.log", iCall).c_str(), "w");
         fprintf(fp, " Iter   TP_its  xval   Func_val  |  Reasoning\n");
         fprintf(fp, "-----------------------------------------------------"
                 "-------------------------------\n");
@@ -453,7 +453,7 @@ void OneDim::save(const std::string& fname, std::string id,
     }
     root.write(s);
     s.close();
-    debuglog("Solution saved to file "+fname+" as solution "+id+".\n", loglevel);
+    debuglog(loglevel, "Solution saved to file {} as solution {}.\n", fname, id);
 }
 
 }
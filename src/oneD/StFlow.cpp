@@ -666,7 +666,7 @@ void StFlow::restore(const XML_Node& dom, doublereal* soln, int loglevel)
                 soln[index(3,j)] = x[j];
             }
         } else if (m_thermo->speciesIndex(nm) != npos) {
-            debuglog(nm+"   ", loglevel >= 2);
+            debuglog(loglevel >= 2, "{}   ", nm);
             if (x.size() == np) {
                 size_t k = m_thermo->speciesIndex(nm);
                 did_species[k] = 1;
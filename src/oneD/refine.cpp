@@ -66,9 +66,12 @@ int Refiner::analyze(size_t n, const doublereal* z,
     }
 
     // find locations where cell size ratio is too large.
-    vector_fp v(n), s(n-1);
-
-    vector_fp dz(n-1);
+    vector_fp& v = m_v;
+    vector_fp& s = m_s;
+    vector_fp& dz = m_dz;
+    v.resize(n);
+    s.resize(n-1);
+    dz.resize(n-1);
     for (size_t j = 0; j < n-1; j++) {
         dz[j] = z[j+1] - z[j];
     }
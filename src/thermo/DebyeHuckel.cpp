@@ -527,19 +527,15 @@ void DebyeHuckel::initThermoXML(XML_Node& phaseNode, const std::string& id_)
     // Now go get the specification of the standard states for species in the
     // solution. This includes the molar volumes data blocks for incompressible
     // species.
-    XML_Node& speciesList = phaseNode.child("speciesArray");
-    XML_Node* speciesDB =
-        get_XML_NameID("speciesData", speciesList["datasrc"],
-                       &phaseNode.root());
     const vector<string>&sss = speciesNames();
 
     for (size_t k = 0; k < m_kk; k++) {
-        XML_Node* s = speciesDB->findByAttr("name", sss[k]);
+        const XML_Node* s = speciesData()[k];
         if (!s) {
             throw CanteraError("DebyeHuckel::initThermoXML",
                                "Species Data Base " + sss[k] + " not found");
         }
-        XML_Node* ss = s->findByName("standardState");
+        const XML_Node* ss = s->findByName("standardState");
         if (!ss) {
             throw CanteraError("DebyeHuckel::initThermoXML",
                                "Species " + sss[k] +
@@ -807,6 +803,10 @@ void DebyeHuckel::initThermoXML(XML_Node& phaseNode, const std::string& id_)
         }
     }
 
+    // The model parameters may have changed since any cached activity
+    // coefficients were computed
+    invalidateCache();
+
     // Lastly set the state
     if (phaseNode.hasChild("state")) {
         XML_Node& stateNode = phaseNode.child("state");
@@ -826,12 +826,19 @@ double DebyeHuckel::A_Debye_TP(double tempArg, double presArg) const
         P = presArg;
     }
 
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
     switch (m_form_A_Debye) {
     case A_DEBYE_CONST:
         A = m_A_Debye;
         break;
     case A_DEBYE_WATER:
-        A = m_waterProps->ADebye(T, P, 0);
+        if (cached.validate(T, P)) {
+            A = cached.value;
+        } else {
+            A = m_waterProps->ADebye(T, P, 0);
+            cached.value = A;
+        }
         m_A_Debye = A;
         break;
     default:
@@ -851,12 +858,19 @@ double DebyeHuckel::dA_DebyedT_TP(double tempArg, double presArg) const
         P = presArg;
     }
     double dAdT;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
     switch (m_form_A_Debye) {
     case A_DEBYE_CONST:
         dAdT = 0.0;
         break;
     case A_DEBYE_WATER:
-        dAdT = m_waterProps->ADebye(T, P, 1);
+        if (cached.validate(T, P)) {
+            dAdT = cached.value;
+        } else {
+            dAdT = m_waterProps->ADebye(T, P, 1);
+            cached.value = dAdT;
+        }
         break;
     default:
         throw CanteraError("DebyeHuckel::dA_DebyedT_TP", "shouldn't be here");
@@ -875,12 +889,19 @@ double DebyeHuckel::d2A_DebyedT2_TP(double tempArg, double presArg) const
         P = presArg;
     }
     double d2AdT2;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
     switch (m_form_A_Debye) {
     case A_DEBYE_CONST:
         d2AdT2 = 0.0;
         break;
     case A_DEBYE_WATER:
-        d2AdT2 = m_waterProps->ADebye(T, P, 2);
+        if (cached.validate(T, P)) {
+            d2AdT2 = cached.value;
+        } else {
+            d2AdT2 = m_waterProps->ADebye(T, P, 2);
+            cached.value = d2AdT2;
+        }
         break;
     default:
         throw CanteraError("DebyeHuckel::d2A_DebyedT2_TP", "shouldn't be here");
@@ -899,12 +920,19 @@ double DebyeHuckel::dA_DebyedP_TP(double tempArg, double presArg) const
         P = presArg;
     }
     double dAdP;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
     switch (m_form_A_Debye) {
     case A_DEBYE_CONST:
         dAdP = 0.0;
         break;
     case A_DEBYE_WATER:
-        dAdP = m_waterProps->ADebye(T, P, 3);
+        if (cached.validate(T, P)) {
+            dAdP = cached.value;
+        } else {
+            dAdP = m_waterProps->ADebye(T, P, 3);
+            cached.value = dAdP;
+        }
         break;
     default:
         throw CanteraError("DebyeHuckel::dA_DebyedP_TP", "shouldn't be here");
@@ -919,6 +947,65 @@ double DebyeHuckel::AionicRadius(int k) const
     return m_Aionic[k];
 }
 
+void DebyeHuckel::setA_Debye(double A)
+{
+    m_form_A_Debye = A_DEBYE_CONST;
+    m_A_Debye = A;
+    invalidateCache();
+}
+
+void DebyeHuckel::setB_Debye(double B)
+{
+    m_B_Debye = B;
+    invalidateCache();
+}
+
+void DebyeHuckel::setB_dot(const std::string& sp, double bdot)
+{
+    size_t k = speciesIndex(sp);
+    if (k == npos) {
+        throw CanteraError("DebyeHuckel::setB_dot",
+                           "Species '{}' not found", sp);
+    }
+    if (m_formDH == DHFORM_BETAIJ || m_formDH == DHFORM_DILUTE_LIMIT ||
+            m_formDH == DHFORM_PITZER_BETAIJ) {
+        throw CanteraError("DebyeHuckel::setB_dot",
+                           "B_dot is not used by this form of the model");
+    }
+    m_B_Dot[k] = bdot;
+    invalidateCache();
+}
+
+void DebyeHuckel::setIonicRadius(const std::string& sp, double a)
+{
+    size_t k = speciesIndex(sp);
+    if (k == npos) {
+        throw CanteraError("DebyeHuckel::setIonicRadius",
+                           "Species '{}' not found", sp);
+    }
+    m_Aionic[k] = a;
+    invalidateCache();
+}
+
+void DebyeHuckel::setBeta(const std::string& sp1, const std::string& sp2,
+                          double beta)
+{
+    size_t k1 = speciesIndex(sp1);
+    size_t k2 = speciesIndex(sp2);
+    if (k1 == npos || k2 == npos) {
+        throw CanteraError("DebyeHuckel::setBeta",
+                           "Species '{}' or '{}' not found", sp1, sp2);
+    }
+    if (m_formDH != DHFORM_BETAIJ && m_formDH != DHFORM_PITZER_BETAIJ) {
+        throw CanteraError("DebyeHuckel::setBeta",
+                           "Beta is not used by this form of the model");
+    }
+    m_Beta_ij.resize(m_kk, m_kk, 0.0);
+    m_Beta_ij(k1, k2) = beta;
+    m_Beta_ij(k2, k1) = beta;
+    invalidateCache();
+}
+
 // ------------ Private and Restricted Functions ------------------
 
 bool DebyeHuckel::addSpecies(shared_ptr<Species> spec)
@@ -995,6 +1082,15 @@ void DebyeHuckel::s_update_lnMolalityActCoeff() const
     // Update the internally stored vector of molalities
     calcMolalities();
 
+    // The activity coefficients depend on the composition through the
+    // molalities, and on T and P through A_Debye
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        m_A_Debye = A_Debye_TP();
+        return;
+    }
+
     // Calculate the apparent (real) ionic strength.
     //
     // Note this is not the stoichiometric ionic strengh, where reactions of
@@ -1219,6 +1315,11 @@ void DebyeHuckel::s_update_lnMolalityActCoeff() const
 void DebyeHuckel::s_update_dlnMolalityActCoeff_dT() const
 {
     double z_k, coeff, tmp, y, yp1, sigma, tmpLn;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     // First we store dAdT explicitly here
     double dAdT = dA_DebyedT_TP();
     if (dAdT == 0.0) {
@@ -1338,6 +1439,11 @@ void DebyeHuckel::s_update_dlnMolalityActCoeff_dT() const
 void DebyeHuckel::s_update_d2lnMolalityActCoeff_dT2() const
 {
     double z_k, coeff, tmp, y, yp1, sigma, tmpLn;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     double dAdT = dA_DebyedT_TP();
     double d2AdT2 = d2A_DebyedT2_TP();
     if (d2AdT2 == 0.0 && dAdT == 0.0) {
@@ -1454,6 +1560,11 @@ void DebyeHuckel::s_update_dlnMolalityActCoeff_dP() const
 {
     double z_k, coeff, tmp, y, yp1, sigma, tmpLn;
     int est;
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     double dAdP = dA_DebyedP_TP();
     if (dAdP == 0.0) {
         for (size_t k = 0; k < m_kk; k++) {
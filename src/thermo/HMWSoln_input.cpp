@@ -1083,19 +1083,15 @@ void HMWSoln::initThermoXML(XML_Node& phaseNode, const std::string& id_)
     // Now go get the specification of the standard states for species in the
     // solution. This includes the molar volumes data blocks for incompressible
     // species.
-    XML_Node& speciesList = phaseNode.child("speciesArray");
-    XML_Node* speciesDB =
-        get_XML_NameID("speciesData", speciesList["datasrc"],
-                       &phaseNode.root());
     const vector<string>&sss = speciesNames();
 
     for (size_t k = 0; k < m_kk; k++) {
-        XML_Node* s = speciesDB->findByAttr("name", sss[k]);
+        const XML_Node* s = speciesData()[k];
         if (!s) {
             throw CanteraError("HMWSoln::initThermoXML",
                                "Species Data Base " + sss[k] + " not found");
         }
-        XML_Node* ss = s->findByName("standardState");
+        const XML_Node* ss = s->findByName("standardState");
         if (!ss) {
             throw CanteraError("HMWSoln::initThermoXML",
                                "Species " + sss[k] +
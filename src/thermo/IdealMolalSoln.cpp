@@ -507,15 +507,17 @@ void IdealMolalSoln::initThermoXML(XML_Node& phaseNode, const std::string& id_)
     }
 
     // Now go get the molar volumes
-    XML_Node& speciesList = phaseNode.child("speciesArray");
-    XML_Node* speciesDB =
-        get_XML_NameID("speciesData", speciesList["datasrc"],
-                       &phaseNode.root());
-    const std::vector<std::string> &sss = speciesNames();
-
+    const std::vector<const XML_Node*>& data = speciesData();
     for (size_t k = 0; k < m_kk; k++) {
-        XML_Node* s = speciesDB->findByAttr("name", sss[k]);
-        XML_Node* ss = s->findByName("standardState");
+        if (k >= data.size() || !data[k]) {
+            throw CanteraError("IdealMolalSoln::initThermoXML",
+                "No XML data for species '{}'", speciesName(k));
+        }
+        const XML_Node* ss = data[k]->findByName("standardState");
+        if (!ss) {
+            throw CanteraError("IdealMolalSoln::initThermoXML",
+                "No standardState node for species '{}'", speciesName(k));
+        }
         m_speciesMolarVolume[k] = getFloat(*ss, "molarVolume", "toSI");
     }
 
@@ -542,6 +544,13 @@ void IdealMolalSoln::s_updateIMS_lnMolalityActCoeff() const
     // with respect to the contents of the State objects' data.
     calcMolalities();
 
+    // The activity coefficients depend only on the composition
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(stateMFNumber())) {
+        return;
+    }
+
     double xmolSolvent = moleFraction(m_indexSolvent);
     double xx = std::max(m_xmolSolventMIN, xmolSolvent);
 
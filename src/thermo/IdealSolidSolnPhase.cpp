@@ -480,13 +480,17 @@ void IdealSolidSolnPhase::initThermoXML(XML_Node& phaseNode, const std::string&
     }
 
     // Now go get the molar volumes
-    XML_Node& speciesList = phaseNode.child("speciesArray");
-    XML_Node* speciesDB = get_XML_NameID("speciesData", speciesList["datasrc"],
-                                         &phaseNode.root());
-
+    const std::vector<const XML_Node*>& data = speciesData();
     for (size_t k = 0; k < m_kk; k++) {
-        XML_Node* s = speciesDB->findByAttr("name", speciesName(k));
-        XML_Node* ss = s->findByName("standardState");
+        if (k >= data.size() || !data[k]) {
+            throw CanteraError("IdealSolidSolnPhase::initThermoXML",
+                "No XML data for species '{}'", speciesName(k));
+        }
+        const XML_Node* ss = data[k]->findByName("standardState");
+        if (!ss) {
+            throw CanteraError("IdealSolidSolnPhase::initThermoXML",
+                "No standardState node for species '{}'", speciesName(k));
+        }
         m_speciesMolarVolume[k] = getFloat(*ss, "molarVolume", "toSI");
     }
 
@@ -291,16 +291,13 @@ void LatticePhase::initThermoXML(XML_Node& phaseNode, const std::string& id_)
     }
 
     // Now go get the molar volumes. use the default if not found
-    XML_Node& speciesList = phaseNode.child("speciesArray");
-    XML_Node* speciesDB = get_XML_NameID("speciesData", speciesList["datasrc"], &phaseNode.root());
-
     for (size_t k = 0; k < m_kk; k++) {
         m_speciesMolarVolume[k] = m_site_density;
-        XML_Node* s = speciesDB->findByAttr("name", speciesName(k));
+        const XML_Node* s = speciesData()[k];
         if (!s) {
             throw CanteraError(" LatticePhase::initThermoXML", "database problems");
         }
-        XML_Node* ss = s->findByName("standardState");
+        const XML_Node* ss = s->findByName("standardState");
         if (ss && ss->findByName("molarVolume")) {
             m_speciesMolarVolume[k] = getFloat(*ss, "molarVolume", "toSI");
         }
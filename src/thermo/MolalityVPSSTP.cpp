@@ -94,6 +94,7 @@ void MolalityVPSSTP::setSolvent(size_t k)
                    "Molality-based methods limit solvent id to being 0");
     m_weightSolvent = molecularWeight(k);
     m_Mnaught = m_weightSolvent / 1000.;
+    invalidateCache();
 }
 
 size_t MolalityVPSSTP::solventIndex() const
@@ -109,6 +110,7 @@ void MolalityVPSSTP::setMoleFSolventMin(doublereal xmolSolventMIN)
         throw CanteraError("MolalityVPSSTP::setSolute ", "trouble");
     }
     m_xmolSolventMIN = xmolSolventMIN;
+    invalidateCache();
 }
 
 doublereal MolalityVPSSTP::moleFSolventMin() const
@@ -118,6 +120,11 @@ doublereal MolalityVPSSTP::moleFSolventMin() const
 
 void MolalityVPSSTP::calcMolalities() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(stateMFNumber())) {
+        return;
+    }
     getMoleFractions(m_molalities.data());
     double xmolSolvent = std::max(m_molalities[m_indexSolvent], m_xmolSolventMIN);
     double denomInv = 1.0/ (m_Mnaught * xmolSolvent);
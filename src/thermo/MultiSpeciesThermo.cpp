@@ -30,16 +30,7 @@ MultiSpeciesThermo::MultiSpeciesThermo(const MultiSpeciesThermo& b) :
 {
     warn_deprecated("MultiSpeciesThermo copy constructor",
         "To be removed after Cantera 2.3");
-    m_sp.clear();
-    // Copy SpeciesThermoInterpTypes from 'b'
-    for (const auto& sp : b.m_sp) {
-        for (size_t k = 0; k < sp.second.size(); k++) {
-            size_t i = sp.second[k].first;
-            shared_ptr<SpeciesThermoInterpType> spec(
-                sp.second[k].second->duplMyselfAsSpeciesThermoInterpType());
-            m_sp[sp.first].emplace_back(i, spec);
-        }
-    }
+    copySpeciesThermo(b);
 }
 
 MultiSpeciesThermo&
@@ -51,17 +42,7 @@ MultiSpeciesThermo::operator=(const MultiSpeciesThermo& b)
         return *this;
     }
 
-    m_sp.clear();
-    // Copy SpeciesThermoInterpType objects from 'b'
-    for (const auto& sp : b.m_sp) {
-        for (size_t k = 0; k < sp.second.size(); k++) {
-            size_t i = sp.second[k].first;
-            shared_ptr<SpeciesThermoInterpType> spec(
-                sp.second[k].second->duplMyselfAsSpeciesThermoInterpType());
-            m_sp[sp.first].emplace_back(i, spec);
-        }
-    }
-
+    copySpeciesThermo(b);
     m_tpoly = b.m_tpoly;
     m_speciesLoc = b.m_speciesLoc;
     m_tlow_max = b.m_tlow_max;
@@ -70,6 +51,28 @@ MultiSpeciesThermo::operator=(const MultiSpeciesThermo& b)
     return *this;
 }
 
+void MultiSpeciesThermo::copySpeciesThermo(const MultiSpeciesThermo& b)
+{
+    m_sp.clear();
+    for (const auto& sp : b.m_sp) {
+        for (size_t k = 0; k < sp.second.size(); k++) {
+            size_t i = sp.second[k].first;
+            if (sp.first == PDSS_TYPE) {
+                // STITbyPDSS objects hold pointers into the owning phase, and
+                // are re-pointed by VPSSMgr::initAllPtrs, so they can't be
+                // shared.
+                shared_ptr<SpeciesThermoInterpType> spec(
+                    sp.second[k].second->duplMyselfAsSpeciesThermoInterpType());
+                m_sp[sp.first].emplace_back(i, spec);
+            } else {
+                // The parameterizations are immutable except through
+                // provideUniqueSTIT(), so they can be shared with 'b'
+                m_sp[sp.first].emplace_back(i, sp.second[k].second);
+            }
+        }
+    }
+}
+
 MultiSpeciesThermo* MultiSpeciesThermo::duplMyselfAsSpeciesThermo() const
 {
     warn_deprecated("MultiSpeciesThermo::duplMyselfAsSpeciesThermo",
@@ -240,6 +243,20 @@ const SpeciesThermoInterpType* MultiSpeciesThermo::provideSTIT(size_t k) const
     }
 }
 
+SpeciesThermoInterpType* MultiSpeciesThermo::provideUniqueSTIT(size_t k)
+{
+    try {
+        const std::pair<int, size_t>& loc = m_speciesLoc.at(k);
+        shared_ptr<SpeciesThermoInterpType>& stit = m_sp.at(loc.first)[loc.second].second;
+        if (stit.use_count() > 1) {
+            stit.reset(stit->duplMyselfAsSpeciesThermoInterpType());
+        }
+        return stit.get();
+    } catch (std::out_of_range&) {
+        return 0;
+    }
+}
+
 doublereal MultiSpeciesThermo::reportOneHf298(const size_t k) const
 {
     const SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
@@ -252,7 +269,7 @@ doublereal MultiSpeciesThermo::reportOneHf298(const size_t k) const
 
 void MultiSpeciesThermo::modifyOneHf298(const size_t k, const doublereal Hf298New)
 {
-    SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
+    SpeciesThermoInterpType* sp_ptr = provideUniqueSTIT(k);
     if (sp_ptr) {
         sp_ptr->modifyOneHf298(k, Hf298New);
     }
@@ -260,7 +277,7 @@ void MultiSpeciesThermo::modifyOneHf298(const size_t k, const doublereal Hf298Ne
 
 void MultiSpeciesThermo::resetHf298(const size_t k)
 {
-    SpeciesThermoInterpType* sp_ptr = provideSTIT(k);
+    SpeciesThermoInterpType* sp_ptr = provideUniqueSTIT(k);
     if (sp_ptr) {
         sp_ptr->resetHf298();
     }
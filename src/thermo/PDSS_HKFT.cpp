@@ -28,6 +28,7 @@ PDSS_HKFT::PDSS_HKFT(VPStandardStateTP* tp, size_t spindex) :
     PDSS(tp, spindex),
     m_waterSS(0),
     m_densWaterSS(-1.0),
+    m_solventCache(new SolventCache()),
     m_born_coeff_j(-1.0),
     m_r_e_j(-1.0),
     m_deltaG_formation_tr_pr(0.0),
@@ -58,6 +59,7 @@ PDSS_HKFT::PDSS_HKFT(VPStandardStateTP* tp, size_t spindex,
     PDSS(tp, spindex),
     m_waterSS(0),
     m_densWaterSS(-1.0),
+    m_solventCache(new SolventCache()),
     m_born_coeff_j(-1.0),
     m_r_e_j(-1.0),
     m_deltaG_formation_tr_pr(0.0),
@@ -91,6 +93,7 @@ PDSS_HKFT::PDSS_HKFT(VPStandardStateTP* tp, size_t spindex, const XML_Node& spec
     PDSS(tp, spindex),
     m_waterSS(0),
     m_densWaterSS(-1.0),
+    m_solventCache(new SolventCache()),
     m_born_coeff_j(-1.0),
     m_r_e_j(-1.0),
     m_deltaG_formation_tr_pr(0.0),
@@ -122,6 +125,7 @@ PDSS_HKFT::PDSS_HKFT(const PDSS_HKFT& b) :
     PDSS(b),
     m_waterSS(0),
     m_densWaterSS(-1.0),
+    m_solventCache(new SolventCache()),
     m_born_coeff_j(-1.0),
     m_r_e_j(-1.0),
     m_deltaG_formation_tr_pr(0.0),
@@ -183,6 +187,7 @@ PDSS_HKFT& PDSS_HKFT::operator=(const PDSS_HKFT& b)
     // Here we just fill these in so that local copies within the VPSS object work.
     m_waterSS = b.m_waterSS;
     m_waterProps.reset(new WaterProps(m_waterSS));
+    m_solventCache.reset(new SolventCache());
 
     return *this;
 }
@@ -262,10 +267,10 @@ doublereal PDSS_HKFT::cp_mole() const
                              -2.0*m_charge_j*dgvaldT*dgvaldT/(r_e_H2*r_e_H) + m_charge_j*d2gvaldT2 /r_e_H2);
     }
 
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
-    doublereal drelepsilondT = m_waterProps->relEpsilon(m_temp, m_pres, 1);
+    doublereal relepsilon = relEpsilon(m_temp, m_pres, 0);
+    doublereal drelepsilondT = relEpsilon(m_temp, m_pres, 1);
     doublereal Y = drelepsilondT / (relepsilon * relepsilon);
-    doublereal d2relepsilondT2 = m_waterProps->relEpsilon(m_temp, m_pres, 2);
+    doublereal d2relepsilondT2 = relEpsilon(m_temp, m_pres, 2);
 
     doublereal X = d2relepsilondT2 / (relepsilon* relepsilon) - 2.0 * relepsilon * Y * Y;
     doublereal Z = -1.0 / relepsilon;
@@ -314,8 +319,8 @@ doublereal PDSS_HKFT::molarVolume() const
                      + nu * m_charge_j / (r_e_H * r_e_H) * dgvaldP;
     }
 
-    doublereal drelepsilondP = m_waterProps->relEpsilon(m_temp, m_pres, 3);
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
+    doublereal drelepsilondP = relEpsilon(m_temp, m_pres, 3);
+    doublereal relepsilon = relEpsilon(m_temp, m_pres, 0);
     doublereal Q = drelepsilondP / (relepsilon * relepsilon);
     doublereal Z = -1.0 / relepsilon;
     doublereal wterm = - domega_jdP * (Z + 1.0);
@@ -387,15 +392,16 @@ void PDSS_HKFT::initThermo()
     PDSS::initThermo();
 
     m_waterSS = &dynamic_cast<PDSS_Water&>(*m_tp->providePDSS(0));
+    shareSolventCache();
 
     // Section to initialize m_Z_pr_tr and m_Y_pr_tr
     m_temp = 273.15 + 25.;
     m_pres = OneAtm;
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
+    doublereal relepsilon = relEpsilon(m_temp, m_pres, 0);
     m_waterSS->setState_TP(m_temp, m_pres);
     m_densWaterSS = m_waterSS->density();
     m_Z_pr_tr = -1.0 / relepsilon;
-    doublereal drelepsilondT = m_waterProps->relEpsilon(m_temp, m_pres, 1);
+    doublereal drelepsilondT = relEpsilon(m_temp, m_pres, 1);
     m_Y_pr_tr = drelepsilondT / (relepsilon * relepsilon);
     m_waterProps.reset(new WaterProps(m_waterSS));
     m_presR_bar = OneAtm / 1.0E5;
@@ -450,6 +456,18 @@ void PDSS_HKFT::initAllPtrs(VPStandardStateTP* vptp_ptr, VPSSMgr* vpssmgr_ptr,
     PDSS::initAllPtrs(vptp_ptr, vpssmgr_ptr, spthermo_ptr);
     m_waterSS = &dynamic_cast<PDSS_Water&>(*m_tp->providePDSS(0));
     m_waterProps.reset(new WaterProps(m_waterSS));
+    shareSolventCache();
+}
+
+void PDSS_HKFT::shareSolventCache()
+{
+    for (size_t k = 0; k < m_spindex; k++) {
+        PDSS_HKFT* other = dynamic_cast<PDSS_HKFT*>(m_tp->providePDSS(k));
+        if (other && other->m_waterSS == m_waterSS) {
+            m_solventCache = other->m_solventCache;
+            return;
+        }
+    }
 }
 
 void PDSS_HKFT::constructPDSSXML(VPStandardStateTP* tp, size_t spindex,
@@ -651,8 +669,8 @@ doublereal PDSS_HKFT::deltaH() const
                      + nu * m_charge_j / (3.082 + gval) / (3.082 + gval) * dgvaldT;
     }
 
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
-    doublereal drelepsilondT = m_waterProps->relEpsilon(m_temp, m_pres, 1);
+    doublereal relepsilon = relEpsilon(m_temp, m_pres, 0);
+    doublereal drelepsilondT = relEpsilon(m_temp, m_pres, 1);
 
     doublereal Y = drelepsilondT / (relepsilon * relepsilon);
     doublereal Z = -1.0 / relepsilon;
@@ -696,7 +714,7 @@ doublereal PDSS_HKFT::deltaG() const
         omega_j = nu * (m_charge_j * m_charge_j / r_e_j - m_charge_j / (3.082 + gval));
     }
 
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
+    doublereal relepsilon = relEpsilon(m_temp, m_pres, 0);
     doublereal Z = -1.0 / relepsilon;
     doublereal wterm = - omega_j * (Z + 1.0);
     doublereal wrterm = m_omega_pr_tr * (m_Z_pr_tr + 1.0);
@@ -734,8 +752,8 @@ doublereal PDSS_HKFT::deltaS() const
                      + nu * m_charge_j / (3.082 + gval) / (3.082 + gval) * dgvaldT;
     }
 
-    doublereal relepsilon = m_waterProps->relEpsilon(m_temp, m_pres, 0);
-    doublereal drelepsilondT = m_waterProps->relEpsilon(m_temp, m_pres, 1);
+    doublereal relepsilon = relEpsilon(m_temp, m_pres, 0);
+    doublereal drelepsilondT = relEpsilon(m_temp, m_pres, 1);
     doublereal Y = drelepsilondT / (relepsilon * relepsilon);
     doublereal Z = -1.0 / relepsilon;
     doublereal wterm = omega_j * Y;
@@ -865,10 +883,69 @@ doublereal PDSS_HKFT::g(const doublereal temp, const doublereal pres, const int
 
 doublereal PDSS_HKFT::gstar(const doublereal temp, const doublereal pres, const int ifunc) const
 {
-    doublereal gval = g(temp, pres, ifunc);
-    doublereal fval = f(temp, pres, ifunc);
-    double res = gval - fval;
-    return res;
+    if (ifunc < 0 || ifunc > 3) {
+        throw CanteraError("PDSS_HKFT::gstar", "unimplemented");
+    }
+    SolventCache& cache = *m_solventCache;
+    cache.update(temp, pres);
+    if (!cache.m_gstarOK[ifunc]) {
+        doublereal gval = g(temp, pres, ifunc);
+        doublereal fval = f(temp, pres, ifunc);
+        cache.m_gstar[ifunc] = gval - fval;
+        cache.m_gstarOK[ifunc] = true;
+        cache.m_densWater = m_densWaterSS;
+    } else {
+        // Leave the water standard state at (temp, pres), as evaluating g()
+        // does, in case it was changed since the cached values were computed.
+        // The pressure of the water standard state is computed from its
+        // density, so the density is compared instead.
+        if (m_waterSS->temperature() != temp
+            || m_waterSS->density() != cache.m_densWater) {
+            m_waterSS->setState_TP(temp, pres);
+        }
+        m_densWaterSS = cache.m_densWater;
+    }
+    return cache.m_gstar[ifunc];
+}
+
+doublereal PDSS_HKFT::relEpsilon(const doublereal temp, const doublereal pres,
+                                 const int ifunc) const
+{
+    if (ifunc < 0 || ifunc > 3) {
+        throw CanteraError("PDSS_HKFT::relEpsilon", "unimplemented");
+    }
+    SolventCache& cache = *m_solventCache;
+    cache.update(temp, pres);
+    if (!cache.m_relEpsOK[ifunc]) {
+        cache.m_relEps[ifunc] = m_waterProps->relEpsilon(temp, pres, ifunc);
+        cache.m_relEpsOK[ifunc] = true;
+    }
+    return cache.m_relEps[ifunc];
+}
+
+PDSS_HKFT::SolventCache::SolventCache() :
+    m_temp(-1.0),
+    m_pres(-1.0),
+    m_densWater(-1.0)
+{
+    for (int i = 0; i < 4; i++) {
+        m_gstar[i] = 0.0;
+        m_gstarOK[i] = false;
+        m_relEps[i] = 0.0;
+        m_relEpsOK[i] = false;
+    }
+}
+
+void PDSS_HKFT::SolventCache::update(doublereal temp, doublereal pres)
+{
+    if (temp != m_temp || pres != m_pres) {
+        m_temp = temp;
+        m_pres = pres;
+        for (int i = 0; i < 4; i++) {
+            m_gstarOK[i] = false;
+            m_relEpsOK[i] = false;
+        }
+    }
 }
 
 doublereal PDSS_HKFT::LookupGe(const std::string& elemName)
@@ -21,11 +21,13 @@ Phase::Phase() :
     m_ndim(3),
     m_undefinedElementBehavior(UndefElement::error),
     m_xml(new XML_Node("phase")),
+    m_xmlRoot(m_xml),
     m_id("<phase>"),
     m_temp(0.001),
     m_dens(0.001),
     m_mmw(0.0),
     m_stateNum(-1),
+    m_stateNumMax(-1),
     m_mm(0),
     m_elem_type(0)
 {
@@ -41,6 +43,7 @@ Phase::Phase(const Phase& right) :
     m_dens(0.001),
     m_mmw(0.0),
     m_stateNum(-1),
+    m_stateNumMax(-1),
     m_mm(0),
     m_elem_type(0)
 {
@@ -67,8 +70,11 @@ Phase& Phase::operator=(const Phase& right)
     m_molwts = right.m_molwts;
     m_rmolwts = right.m_rmolwts;
     m_stateNum = -1;
+    m_stateNumMax = -1;
+    m_cache.clear();
 
     m_speciesNames = right.m_speciesNames;
+    m_speciesIndices = right.m_speciesIndices;
     m_speciesComp = right.m_speciesComp;
     m_speciesCharge = right.m_speciesCharge;
     m_speciesSize = right.m_speciesSize;
@@ -79,26 +85,13 @@ Phase& Phase::operator=(const Phase& right)
     m_entropy298 = right.m_entropy298;
     m_elem_type = right.m_elem_type;
 
-    // This is a little complicated. -> Because we delete m_xml in the
-    // destructor, we own m_xml completely, and we need to have our own
-    // individual copies of the XML data tree in each object
-    if (m_xml) {
-        XML_Node* rroot = &m_xml->root();
-        delete rroot;
-        m_xml = 0;
-    }
-    if (right.m_xml) {
-        XML_Node *rroot = &right.m_xml->root();
-        XML_Node *root_xml = new XML_Node();
-        rroot->copy(root_xml);
-        m_xml = findXMLPhase(root_xml, right.m_xml->id());
-        if (!m_xml) {
-          throw CanteraError("Phase::operator=()", "Confused: Couldn't find original phase " + right.m_xml->id());
-        }
-        if (&m_xml->root() != root_xml) {
-          throw CanteraError("Phase::operator=()", "confused: root changed");
-        }
-    }
+    // The species objects are not modified after the phase is constructed,
+    // so they are shared with 'right' rather than copied. The XML data tree
+    // is shared until a modifiable reference to it is requested from either
+    // phase (see modifiableXml()).
+    m_species = right.m_species;
+    m_xmlRoot = right.m_xmlRoot;
+    m_xml = right.m_xml;
     m_id = right.m_id;
     m_name = right.m_name;
     return *this;
@@ -106,28 +99,45 @@ Phase& Phase::operator=(const Phase& right)
 
 Phase::~Phase()
 {
-    if (m_xml) {
-        XML_Node* xroot = &m_xml->root();
-        delete xroot;
-    }
-    m_xml = 0;
 }
 
-XML_Node& Phase::xml() const
+const XML_Node& Phase::xml() const
+{
+    return *m_xml;
+}
+
+XML_Node& Phase::modifiableXml()
 {
+    if (m_xmlRoot.use_count() > 1) {
+        // The tree is shared with copies of this phase, which must not see
+        // changes made through the returned reference, so this phase gets
+        // its own copy. The phase node is located in the copy by its
+        // position in the tree.
+        std::vector<size_t> path;
+        for (const XML_Node* node = m_xml; node->parent();
+             node = node->parent()) {
+            const std::vector<XML_Node*>& siblings = node->parent()->children();
+            path.push_back(find(siblings.begin(), siblings.end(), node)
+                           - siblings.begin());
+        }
+        shared_ptr<XML_Node> root(new XML_Node());
+        m_xmlRoot->copy(root.get());
+        XML_Node* node = root.get();
+        for (auto i = path.rbegin(); i != path.rend(); ++i) {
+            node = node->children()[*i];
+        }
+        m_xmlRoot = root;
+        m_xml = node;
+    }
     return *m_xml;
 }
 
-void Phase::setXMLdata(XML_Node& xmlPhase)
+void Phase::setXMLdata(const XML_Node& xmlPhase)
 {
     XML_Node* xroot = &xmlPhase.root();
     XML_Node *root_xml = new XML_Node();
     xroot->copy(root_xml);
-    if (m_xml) {
-       XML_Node *rOld = &m_xml->root();
-       delete rOld;
-       m_xml = 0;
-    }
+    m_xmlRoot.reset(root_xml);
     m_xml = findXMLPhase(root_xml, xmlPhase.id());
     if (!m_xml) {
         throw CanteraError("Phase::setXMLdata()", "XML 'phase' node not found");
@@ -307,7 +317,6 @@ void Phase::saveState(size_t lenstate, doublereal* state) const
 void Phase::restoreState(const vector_fp& state)
 {
     restoreState(state.size(),&state[0]);
-    compositionChanged();
 }
 
 void Phase::restoreState(size_t lenstate, const doublereal* state)
@@ -322,6 +331,61 @@ void Phase::restoreState(size_t lenstate, const doublereal* state)
     }
 }
 
+void Phase::saveState(StateSnapshot& state) const
+{
+    if (state.nSpecies() != m_kk) {
+        state.resize(m_kk);
+    }
+    state.m_data[0] = m_temp;
+    state.m_data[1] = m_dens;
+    copy(m_y.begin(), m_y.end(), state.m_data.begin() + 2);
+    copy(m_ym.begin(), m_ym.end(), state.m_ym.begin());
+    state.m_mmw = m_mmw;
+    state.m_stateNum = m_stateNum;
+    state.m_owner = this;
+}
+
+void Phase::restoreState(const StateSnapshot& state)
+{
+    if (state.m_owner != this || state.nSpecies() != m_kk) {
+        // Species may have been added since the snapshot was taken
+        restoreState(state.size(), state.data());
+        return;
+    }
+    if (state.m_stateNum == m_stateNum && state.m_data[0] == m_temp
+        && state.m_data[1] == m_dens) {
+        return;
+    }
+    copy(state.m_data.begin() + 2, state.m_data.end(), m_y.begin());
+    copy(state.m_ym.begin(), state.m_ym.end(), m_ym.begin());
+    m_mmw = state.m_mmw;
+    compositionChanged();
+    setTemperature(state.m_data[0]);
+    setDensity(state.m_data[1]);
+    // The composition is identical to the one at the time the snapshot was
+    // taken, so the state number from that time identifies it uniquely.
+    m_stateNum = state.m_stateNum;
+}
+
+void Phase::copyStateFrom(const Phase& other)
+{
+    copyCompositionFrom(other);
+    setTemperature(other.m_temp);
+    setDensity(other.m_dens);
+}
+
+void Phase::copyCompositionFrom(const Phase& other)
+{
+    if (other.m_kk != m_kk || other.m_molwts != m_molwts) {
+        throw CanteraError("Phase::copyStateFrom", "Phase '{}' does not have "
+                           "the same species as phase '{}'", other.name(), name());
+    }
+    copy(other.m_y.begin(), other.m_y.end(), m_y.begin());
+    copy(other.m_ym.begin(), other.m_ym.end(), m_ym.begin());
+    m_mmw = other.m_mmw;
+    compositionChanged();
+}
+
 void Phase::setMoleFractions(const doublereal* const x)
 {
     // Use m_y as a temporary work vector for the non-negative mole fractions
@@ -365,16 +429,16 @@ void Phase::setMoleFractions_NoNorm(const doublereal* const x)
 
 void Phase::setMoleFractionsByName(const compositionMap& xMap)
 {
-    vector_fp mf(m_kk, 0.0);
+    m_compWork.assign(m_kk, 0.0);
     for (const auto& sp : xMap) {
         try {
-            mf[m_speciesIndices.at(sp.first)] = sp.second;
+            m_compWork[m_speciesIndices.at(sp.first)] = sp.second;
         } catch (std::out_of_range&) {
             throw CanteraError("Phase::setMoleFractionsByName",
                                "Unknown species '{}'", sp.first);
         }
     }
-    setMoleFractions(&mf[0]);
+    setMoleFractions(m_compWork.data());
 }
 
 void Phase::setMoleFractionsByName(const std::string& x)
@@ -409,16 +473,16 @@ void Phase::setMassFractions_NoNorm(const doublereal* const y)
 
 void Phase::setMassFractionsByName(const compositionMap& yMap)
 {
-    vector_fp mf(m_kk, 0.0);
+    m_compWork.assign(m_kk, 0.0);
     for (const auto& sp : yMap) {
         try {
-            mf[m_speciesIndices.at(sp.first)] = sp.second;
+            m_compWork[m_speciesIndices.at(sp.first)] = sp.second;
         } catch (std::out_of_range&) {
             throw CanteraError("Phase::setMassFractionsByName",
                                "Unknown species '{}'", sp.first);
         }
     }
-    setMassFractions(&mf[0]);
+    setMassFractions(m_compWork.data());
 }
 
 void Phase::setMassFractionsByName(const std::string& y)
@@ -895,7 +959,7 @@ void Phase::invalidateCache() {
 }
 
 void Phase::compositionChanged() {
-    m_stateNum++;
+    m_stateNum = ++m_stateNumMax;
 }
 
 } // namespace Cantera
@@ -123,7 +123,7 @@ std::string eosTypeString(int ieos, int length)
     return "UnknownPhaseType";
 }
 
-ThermoPhase* newPhase(XML_Node& xmlphase)
+ThermoPhase* newPhase(const XML_Node& xmlphase)
 {
     string model = xmlphase.child("thermo")["model"];
     unique_ptr<ThermoPhase> t(newThermoPhase(model));
@@ -170,6 +170,10 @@ static void formSpeciesXMLNodeList(std::vector<XML_Node*> &spDataNodeList,
     // used to check that each species is declared only once
     std::map<std::string, bool> declared;
 
+    // Name index for each species database, built on first use. Several
+    // speciesArray elements may refer to the same database.
+    std::map<const XML_Node*, std::unordered_map<std::string, XML_Node*> > dbIndex;
+
     for (size_t jsp = 0; jsp < spArray_dbases.size(); jsp++) {
         const XML_Node& speciesArray = *spArray_names[jsp];
 
@@ -211,10 +215,12 @@ static void formSpeciesXMLNodeList(std::vector<XML_Node*> &spDataNodeList,
                 }
             }
         } else {
-            std::map<std::string, XML_Node*> speciesNodes;
-            for (size_t k = 0; k < db->nChildren(); k++) {
-                XML_Node& child = db->child(k);
-                speciesNodes[child["name"]] = &child;
+            std::unordered_map<std::string, XML_Node*>& speciesNodes = dbIndex[db];
+            if (speciesNodes.empty()) {
+                for (size_t k = 0; k < db->nChildren(); k++) {
+                    XML_Node& child = db->child(k);
+                    speciesNodes[child["name"]] = &child;
+                }
             }
             for (size_t k = 0; k < nsp; k++) {
                 string stemp = spnames[k];
@@ -235,7 +241,7 @@ static void formSpeciesXMLNodeList(std::vector<XML_Node*> &spDataNodeList,
     }
 }
 
-void importPhase(XML_Node& phase, ThermoPhase* th)
+void importPhase(const XML_Node& phase, ThermoPhase* th)
 {
     // Check the the supplied XML node in fact represents a phase.
     if (phase.name() != "phase") {
@@ -390,9 +396,10 @@ void importPhase(XML_Node& phase, ThermoPhase* th)
     th->initThermo();
 
     // Perform any required subclass-specific initialization that requires the
-    // XML phase object
+    // XML phase object. This uses the phase's own copy of the XML tree, made
+    // by setXMLdata() above, since 'phase' may be shared with other phases.
     std::string id = "";
-    th->initThermoXML(phase, id);
+    th->initThermoXML(th->modifiableXml(), id);
 }
 
 void installElements(Phase& th, const XML_Node& phaseNode)
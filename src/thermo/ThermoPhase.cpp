@@ -35,9 +35,6 @@ ThermoPhase::ThermoPhase() :
 
 ThermoPhase::~ThermoPhase()
 {
-    for (size_t k = 0; k < m_speciesData.size(); k++) {
-        delete m_speciesData[k];
-    }
     delete m_spthermo;
 }
 
@@ -65,23 +62,18 @@ ThermoPhase& ThermoPhase::operator=(const ThermoPhase& right)
     }
 
     // We need to destruct first
-    for (size_t k = 0; k < m_speciesData.size(); k++) {
-        delete m_speciesData[k];
-    }
     delete m_spthermo;
 
     // Call the base class assignment operator
     Phase::operator=(right);
 
-    // Pointer to the species thermodynamic property manager
-    // We own this, so we need to do a deep copy
+    // Pointer to the species thermodynamic property manager. We own this, but
+    // the species parameterizations it holds are shared with 'right'.
     m_spthermo = new MultiSpeciesThermo(*right.m_spthermo);
 
-    // Do a deep copy of species Data, because we own this
-    m_speciesData.resize(m_kk);
-    for (size_t k = 0; k < m_kk; k++) {
-        m_speciesData[k] = new XML_Node(*(right.m_speciesData[k]));
-    }
+    // The species data is immutable, so it is shared with 'right'
+    m_speciesData = right.m_speciesData;
+    m_speciesDataNodes = right.m_speciesDataNodes;
 
     m_phi = right.m_phi;
     m_lambdaRRT = right.m_lambdaRRT;
@@ -150,6 +142,26 @@ void ThermoPhase::getElectrochemPotentials(doublereal* mu) const
     }
 }
 
+void ThermoPhase::copyStateFrom(const Phase& other)
+{
+    const ThermoPhase* thermo = dynamic_cast<const ThermoPhase*>(&other);
+    if (!thermo) {
+        Phase::copyStateFrom(other);
+        return;
+    }
+    copyCompositionFrom(other);
+    setTemperature(other.temperature());
+    // Phases where the pressure is an independent variable compute their
+    // density from it. For all other phases, setting the density afterwards
+    // reproduces the state of 'other' exactly.
+    if (pressure() != thermo->pressure()) {
+        setPressure(thermo->pressure());
+    }
+    if (density() != other.density()) {
+        setDensity(other.density());
+    }
+}
+
 void ThermoPhase::setState_TPX(doublereal t, doublereal p, const doublereal* x)
 {
     setMoleFractions(x);
@@ -739,8 +751,10 @@ void ThermoPhase::saveSpeciesData(const size_t k, const XML_Node* const data)
 {
     if (m_speciesData.size() < (k + 1)) {
         m_speciesData.resize(k+1, 0);
+        m_speciesDataNodes.resize(k+1);
     }
-    m_speciesData[k] = new XML_Node(*data);
+    m_speciesDataNodes[k] = make_shared<XML_Node>(*data);
+    m_speciesData[k] = m_speciesDataNodes[k].get();
 }
 
 const std::vector<const XML_Node*> & ThermoPhase::speciesData() const
@@ -235,7 +235,7 @@ VPSSMgrFactory::VPSSMgr_StringConversion(const std::string& ssModel) const
 }
 
 VPSSMgr* VPSSMgrFactory::newVPSSMgr(VPStandardStateTP* vp_ptr,
-                                    XML_Node* phaseNode_ptr,
+                                    const XML_Node* phaseNode_ptr,
                                     std::vector<XML_Node*> & spDataNodeList)
 {
     std::string ssManager;
@@ -331,7 +331,7 @@ VPSSMgr* newVPSSMgr(VPSSMgr_enumType type, VPStandardStateTP* vp_ptr,
 }
 
 VPSSMgr* newVPSSMgr(VPStandardStateTP* tp_ptr,
-                    XML_Node* phaseNode_ptr,
+                    const XML_Node* phaseNode_ptr,
                     std::vector<XML_Node*> & spDataNodeList,
                     VPSSMgrFactory* f)
 {
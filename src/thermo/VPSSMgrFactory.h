@@ -119,7 +119,7 @@ public:
      *                       property manager object.
      */
     virtual VPSSMgr* newVPSSMgr(VPStandardStateTP* vp_ptr,
-                                XML_Node* phaseNode_ptr,
+                                const XML_Node* phaseNode_ptr,
                                 std::vector<XML_Node*> & spDataNodeList);
 
 private:
@@ -180,7 +180,7 @@ VPSSMgr* newVPSSMgr(VPSSMgr_enumType type,
  *     will be removed after Cantera 2.3.
  */
 VPSSMgr* newVPSSMgr(VPStandardStateTP* vp_ptr,
-                    XML_Node* phaseNode_ptr,
+                    const XML_Node* phaseNode_ptr,
                     std::vector<XML_Node*> & spDataNodeList,
                     VPSSMgrFactory* f=0);
 }
@@ -92,12 +92,8 @@ void VPSSMgr_ConstVol::getStandardVolumes_ref(doublereal* vol) const
 void VPSSMgr_ConstVol::initThermoXML(XML_Node& phaseNode, const std::string& id)
 {
     VPSSMgr::initThermoXML(phaseNode, id);
-    XML_Node& speciesList = phaseNode.child("speciesArray");
-    XML_Node* speciesDB = get_XML_NameID("speciesData", speciesList["datasrc"],
-                                         &phaseNode.root());
-
     for (size_t k = 0; k < m_kk; k++) {
-        const XML_Node* s = speciesDB->findByAttr("name", m_vptp_ptr->speciesName(k));
+        const XML_Node* s = m_vptp_ptr->speciesData()[k];
         if (!s) {
             throw CanteraError("VPSSMgr_ConstVol::initThermoXML",
                                "no species Node for species " + m_vptp_ptr->speciesName(k));
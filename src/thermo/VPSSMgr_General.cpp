@@ -30,7 +30,9 @@ namespace Cantera
 
 VPSSMgr_General::VPSSMgr_General(VPStandardStateTP* vp_ptr,
                                  MultiSpeciesThermo* spth) :
-    VPSSMgr(vp_ptr, spth)
+    VPSSMgr(vp_ptr, spth),
+    m_arrayTemp(-1.0),
+    m_arrayPres(-1.0)
 {
     // Might want to do something other than holding this true.
     //    However, for the sake of getting this all up and running,
@@ -40,7 +42,9 @@ VPSSMgr_General::VPSSMgr_General(VPStandardStateTP* vp_ptr,
 }
 
 VPSSMgr_General::VPSSMgr_General(const VPSSMgr_General& right) :
-    VPSSMgr(right.m_vptp_ptr, right.m_spthermo)
+    VPSSMgr(right.m_vptp_ptr, right.m_spthermo),
+    m_arrayTemp(-1.0),
+    m_arrayPres(-1.0)
 {
     m_useTmpStandardStateStorage = true;
     m_useTmpRefStateStorage = true;
@@ -63,6 +67,7 @@ VPSSMgr_General& VPSSMgr_General::operator=(const VPSSMgr_General& b)
     for (size_t k = 0; k < m_kk; k++) {
         m_PDSS_ptrs[k] = m_vptp_ptr->providePDSS(k);
     }
+    groupSpecies();
     return *this;
 }
 
@@ -81,39 +86,93 @@ void VPSSMgr_General::initAllPtrs(VPStandardStateTP* vp_ptr, MultiSpeciesThermo*
     for (size_t k = 0; k < m_kk; k++) {
         m_PDSS_ptrs[k] = m_vptp_ptr->providePDSS(k);
     }
+    groupSpecies();
+}
+
+void VPSSMgr_General::groupSpecies()
+{
+    m_arraySpecies.clear();
+    m_hkftSpecies.clear();
+    m_otherSpecies.clear();
+    for (size_t k = 0; k < m_PDSS_ptrs.size(); k++) {
+        PDSS* kPDSS = m_PDSS_ptrs[k];
+        if (dynamic_cast<PDSS_ConstVol*>(kPDSS)
+            || dynamic_cast<PDSS_SSVol*>(kPDSS)) {
+            m_arraySpecies.push_back(k);
+        } else if (dynamic_cast<PDSS_HKFT*>(kPDSS)) {
+            m_hkftSpecies.push_back(k);
+        } else {
+            m_otherSpecies.push_back(k);
+        }
+    }
+    m_arrayTemp = -1.0;
+    m_arrayPres = -1.0;
 }
 
 void VPSSMgr_General::_updateRefStateThermo() const
 {
     if (m_useTmpRefStateStorage) {
-        for (size_t k = 0; k < m_kk; k++) {
-            PDSS* kPDSS = m_PDSS_ptrs[k];
-            kPDSS->setState_TP(m_tlast, m_plast);
-            m_h0_RT[k] = kPDSS->enthalpy_RT_ref();
-            m_s0_R[k] = kPDSS->entropy_R_ref();
+        for (size_t k : m_arraySpecies) {
+            m_PDSS_ptrs[k]->setState_TP(m_tlast, m_plast);
+        }
+        m_arrayTemp = m_tlast;
+        m_arrayPres = m_plast;
+        for (size_t k : m_arraySpecies) {
+            m_h0_RT[k] = mPDSS_h0_RT[k];
+            m_s0_R[k] = mPDSS_s0_R[k];
             m_g0_RT[k] = m_h0_RT[k] - m_s0_R[k];
-            m_cp0_R[k] = kPDSS->cp_R_ref();
-            m_V0[k] = kPDSS->molarVolume_ref();
+            m_cp0_R[k] = mPDSS_cp0_R[k];
+            m_V0[k] = mPDSS_V0[k];
+        }
+        for (const auto& group : {&m_otherSpecies, &m_hkftSpecies}) {
+            for (size_t k : *group) {
+                PDSS* kPDSS = m_PDSS_ptrs[k];
+                kPDSS->setState_TP(m_tlast, m_plast);
+                m_h0_RT[k] = kPDSS->enthalpy_RT_ref();
+                m_s0_R[k] = kPDSS->entropy_R_ref();
+                m_g0_RT[k] = m_h0_RT[k] - m_s0_R[k];
+                m_cp0_R[k] = kPDSS->cp_R_ref();
+                m_V0[k] = kPDSS->molarVolume_ref();
+            }
         }
     }
 }
 
 void VPSSMgr_General::_updateStandardStateThermo()
 {
-    for (size_t k = 0; k < m_kk; k++) {
-        PDSS* kPDSS = m_PDSS_ptrs[k];
-        kPDSS->setState_TP(m_tlast, m_plast);
-        m_hss_RT[k] = kPDSS->enthalpy_RT();
-        m_sss_R[k] = kPDSS->entropy_R();
+    // The species in m_arraySpecies have already been evaluated at this state
+    // if _updateRefStateThermo() was called just before
+    if (m_arrayTemp != m_tlast || m_arrayPres != m_plast) {
+        for (size_t k : m_arraySpecies) {
+            m_PDSS_ptrs[k]->setState_TP(m_tlast, m_plast);
+        }
+    }
+    m_arrayTemp = -1.0;
+    m_arrayPres = -1.0;
+    for (size_t k : m_arraySpecies) {
+        m_hss_RT[k] = mPDSS_hss_RT[k];
+        m_sss_R[k] = mPDSS_sss_R[k];
         m_gss_RT[k] = m_hss_RT[k] - m_sss_R[k];
-        m_cpss_R[k] = kPDSS->cp_R();
-        m_Vss[k] = kPDSS->molarVolume();
+        m_cpss_R[k] = mPDSS_cpss_R[k];
+        m_Vss[k] = mPDSS_Vss[k];
+    }
+    for (const auto& group : {&m_otherSpecies, &m_hkftSpecies}) {
+        for (size_t k : *group) {
+            PDSS* kPDSS = m_PDSS_ptrs[k];
+            kPDSS->setState_TP(m_tlast, m_plast);
+            m_hss_RT[k] = kPDSS->enthalpy_RT();
+            m_sss_R[k] = kPDSS->entropy_R();
+            m_gss_RT[k] = m_hss_RT[k] - m_sss_R[k];
+            m_cpss_R[k] = kPDSS->cp_R();
+            m_Vss[k] = kPDSS->molarVolume();
+        }
     }
 }
 
 void VPSSMgr_General::initThermo()
 {
     initLengths();
+    groupSpecies();
 }
 
 void VPSSMgr_General::getGibbs_ref(doublereal* g) const
@@ -189,6 +248,7 @@ PDSS* VPSSMgr_General::createInstallPDSS(size_t k, const XML_Node& speciesNode,
         m_PDSS_ptrs.resize(k+1, 0);
     }
     m_PDSS_ptrs[k] = kPDSS;
+    groupSpecies();
     m_kk = std::max(m_kk, k+1);
     m_minTemp = std::max(m_minTemp, kPDSS->minTemp());
     m_maxTemp = std::min(m_maxTemp, kPDSS->maxTemp());
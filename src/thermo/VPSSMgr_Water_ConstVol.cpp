@@ -188,10 +188,6 @@ void VPSSMgr_Water_ConstVol::initThermoXML(XML_Node& phaseNode,
                                            const std::string& id)
 {
     VPSSMgr::initThermoXML(phaseNode, id);
-    XML_Node& speciesList = phaseNode.child("speciesArray");
-    XML_Node* speciesDB = get_XML_NameID("speciesData", speciesList["datasrc"],
-                                         &phaseNode.root());
-
     if (!m_waterSS) {
         throw CanteraError("VPSSMgr_Water_ConstVol::initThermoXML",
                            "bad dynamic cast");
@@ -201,7 +197,7 @@ void VPSSMgr_Water_ConstVol::initThermoXML(XML_Node& phaseNode,
     m_Vss[0] = (m_waterSS->density()) / m_vptp_ptr->molecularWeight(0);
 
     for (size_t k = 1; k < m_kk; k++) {
-        const XML_Node* s = speciesDB->findByAttr("name", m_vptp_ptr->speciesName(k));
+        const XML_Node* s = m_vptp_ptr->speciesData()[k];
         if (!s) {
             throw CanteraError("VPSSMgr_Water_ConstVol::initThermoXML",
                                "no species Node for species " + m_vptp_ptr->speciesName(k));
@@ -189,15 +189,12 @@ void VPSSMgr_Water_HKFT::initThermoXML(XML_Node& phaseNode,
                                        const std::string& id)
 {
     VPSSMgr::initThermoXML(phaseNode, id);
-    XML_Node& speciesList = phaseNode.child("speciesArray");
-    XML_Node* speciesDB = get_XML_NameID("speciesData", speciesList["datasrc"],
-                                         &phaseNode.root());
     m_waterSS->setState_TP(300., OneAtm);
     m_Vss[0] = (m_waterSS->density()) / m_vptp_ptr->molecularWeight(0);
 
     for (size_t k = 1; k < m_kk; k++) {
         string name = m_vptp_ptr->speciesName(k);
-        const XML_Node* s = speciesDB->findByAttr("name", name);
+        const XML_Node* s = m_vptp_ptr->speciesData()[k];
         if (!s) {
             throw CanteraError("VPSSMgr_Water_HKFT::initThermoXML",
                                "No species Node for species " + name);
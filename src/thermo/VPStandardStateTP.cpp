@@ -250,6 +250,19 @@ void VPStandardStateTP::setPressure(doublereal p)
     updateStandardStateThermo();
 }
 
+void VPStandardStateTP::copyStateFrom(const Phase& other)
+{
+    const VPStandardStateTP* vpss = dynamic_cast<const VPStandardStateTP*>(&other);
+    if (!vpss) {
+        ThermoPhase::copyStateFrom(other);
+        return;
+    }
+    copyCompositionFrom(other);
+    setState_TP(other.temperature(), vpss->pressure());
+    updateStandardStateThermo();
+    Phase::setDensity(other.density());
+}
+
 void VPStandardStateTP::calcDensity()
 {
     throw NotImplementedError("VPStandardStateTP::calcDensity() called, "
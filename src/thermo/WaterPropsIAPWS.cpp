@@ -332,7 +332,7 @@ void WaterPropsIAPWS::corr1(doublereal temperature, doublereal pressure,
 
 doublereal WaterPropsIAPWS::psat(doublereal temperature, int waterState)
 {
-    static int method = 1;
+    const int method = 1;
     doublereal densLiq = -1.0, densGas = -1.0, delGRT = 0.0;
     doublereal dp, pcorr;
     if (temperature >= T_c) {
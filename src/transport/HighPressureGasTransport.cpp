@@ -28,6 +28,28 @@ HighPressureGasTransport::HighPressureGasTransport(thermo_t* thermo)
 {
 }
 
+void HighPressureGasTransport::init(thermo_t* thermo, int mode, int log_level)
+{
+    MultiTransport::init(thermo, mode, log_level);
+    m_Tcrit.resize(m_nsp);
+    m_Pcrit.resize(m_nsp);
+    m_Vcrit.resize(m_nsp);
+    m_Zcrit.resize(m_nsp);
+
+    // The critical constants do not depend on the temperature or pressure, so
+    // they are evaluated once here. Evaluating them changes the composition
+    // of the phase, which is restored afterwards.
+    vector_fp state;
+    m_thermo->saveState(state);
+    for (size_t i = 0; i < m_nsp; i++) {
+        m_Tcrit[i] = Tcrit_i(i);
+        m_Pcrit[i] = Pcrit_i(i);
+        m_Vcrit[i] = Vcrit_i(i);
+        m_Zcrit[i] = Zcrit_i(i);
+    }
+    m_thermo->restoreState(state);
+}
+
 double HighPressureGasTransport::thermalConductivity()
 {
     //  Method of Ely and Hanley:
@@ -49,8 +71,8 @@ double HighPressureGasTransport::thermalConductivity()
     doublereal L_i_min = BigNumber;
 
     for (size_t i = 0; i < m_nsp; i++) {
-        doublereal Tc_i = Tcrit_i(i);
-        doublereal Vc_i = Vcrit_i(i);
+        doublereal Tc_i = m_Tcrit[i];
+        doublereal Vc_i = m_Vcrit[i];
         doublereal T_r = m_thermo->temperature()/Tc_i;
         doublereal V_r = V_k[i]/Vc_i;
         doublereal T_p = std::min(T_r,2.0);
@@ -60,7 +82,7 @@ double HighPressureGasTransport::thermalConductivity()
         doublereal theta_p = 1.0 + (m_w_ac[i] - 0.011)*(0.56553
             - 0.86276*log(T_p) - 0.69852/T_p);
         doublereal phi_p = (1.0 + (m_w_ac[i] - 0.011)*(0.38560
-            - 1.1617*log(T_p)))*0.288/Zcrit_i(i);
+            - 1.1617*log(T_p)))*0.288/m_Zcrit[i];
         doublereal f_fac = Tc_i*theta_p/190.4;
         doublereal h_fac = 1000*Vc_i*phi_p/99.2;
         doublereal T_0 = m_temp/f_fac;
@@ -76,7 +98,7 @@ double HighPressureGasTransport::thermalConductivity()
         doublereal theta_s = 1 + (m_w_ac[i] - 0.011)*(0.09057 - 0.86276*log(T_p)
             + (0.31664 - 0.46568/T_p)*(V_p - 0.5));
         doublereal phi_s = (1 + (m_w_ac[i] - 0.011)*(0.39490*(V_p - 1.02355)
-            - 0.93281*(V_p - 0.75464)*log(T_p)))*0.288/Zcrit_i(i);
+            - 0.93281*(V_p - 0.75464)*log(T_p)))*0.288/m_Zcrit[i];
         f_i[i] = Tc_i*theta_s/190.4;
         h_i[i] = 1000*Vc_i*phi_s/99.2;
     }
@@ -160,8 +182,8 @@ void HighPressureGasTransport::getBinaryDiffCoeffs(const size_t ld, doublereal*
             x_j = x_j/(x_i + x_j);
 
             //Calculate Tr and Pr based on mole-fraction-weighted crit constants:
-            double Tr_ij = m_temp/(x_i*Tcrit_i(i) + x_j*Tcrit_i(j));
-            double Pr_ij = m_thermo->pressure()/(x_i*Pcrit_i(i) + x_j*Pcrit_i(j));
+            double Tr_ij = m_temp/(x_i*m_Tcrit[i] + x_j*m_Tcrit[j]);
+            double Pr_ij = m_thermo->pressure()/(x_i*m_Pcrit[i] + x_j*m_Pcrit[j]);
 
             double P_corr_ij;
             if (Pr_ij < 0.1) {
@@ -224,8 +246,8 @@ void HighPressureGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* c
             doublereal x_j = std::max(Tiny, molefracs[j]);
             x_i = x_i/(x_i+x_j);
             x_j = x_j/(x_i+x_j);
-            double Tr_ij = m_temp/(x_i*Tcrit_i(i) + x_j*Tcrit_i(j));
-            double Pr_ij = m_thermo->pressure()/(x_i*Pcrit_i(i) + x_j*Pcrit_i(j));
+            double Tr_ij = m_temp/(x_i*m_Tcrit[i] + x_j*m_Tcrit[j]);
+            double Pr_ij = m_thermo->pressure()/(x_i*m_Pcrit[i] + x_j*m_Pcrit[j]);
 
             double P_corr_ij;
             if (Pr_ij < 0.1) {
@@ -274,9 +296,6 @@ void HighPressureGasTransport::getMultiDiffCoeffs(const size_t ld, doublereal* c
 doublereal HighPressureGasTransport::viscosity()
 {
     // Calculate the high-pressure mixture viscosity, based on the Lucas method.
-    double Tc_mix = 0.;
-    double Pc_mix_n = 0.;
-    double Pc_mix_d = 0.;
     double MW_mix = m_thermo->meanMolecularWeight();
     double MW_H = m_mw[0];
     double MW_L = m_mw[0];
@@ -288,16 +307,16 @@ doublereal HighPressureGasTransport::viscosity()
     vector_fp molefracs(nsp);
     m_thermo->getMoleFractions(&molefracs[0]);
 
+    // Mole-fraction-weighted averages of the pure-species critical constants:
+    double Tc_mix = dot(molefracs.begin(), molefracs.end(), m_Tcrit.begin());
+    double Pc_mix_n = dot(molefracs.begin(), molefracs.end(), m_Zcrit.begin());
+    double Pc_mix_d = dot(molefracs.begin(), molefracs.end(), m_Vcrit.begin());
+
     double x_H = molefracs[0];
     for (size_t i = 0; i < m_nsp; i++) {
-        // Calculate pure-species critical constants and add their contribution
-        // to the mole-fraction-weighted mixture averages:
-        double Tc = Tcrit_i(i);
+        double Tc = m_Tcrit[i];
         double Tr = tKelvin/Tc;
-        double Zc = Zcrit_i(i);
-        Tc_mix += Tc*molefracs[i];
-        Pc_mix_n += molefracs[i]*Zc; //numerator
-        Pc_mix_d += molefracs[i]*Vcrit_i(i); //denominator
+        double Zc = m_Zcrit[i];
 
         // Need to calculate ratio of heaviest to lightest species:
         if (m_mw[i] > MW_H) {
@@ -308,7 +327,7 @@ doublereal HighPressureGasTransport::viscosity()
 
         // Calculate reduced dipole moment for polar correction term:
         doublereal mu_ri = 52.46*100000*m_dipole(i,i)*m_dipole(i,i)
-            *Pcrit_i(i)/(Tc*Tc);
+            *m_Pcrit[i]/(Tc*Tc);
         if (mu_ri < 0.022) {
             FP_mix_o += molefracs[i];
         } else if (mu_ri < 0.075) {
@@ -322,12 +341,12 @@ doublereal HighPressureGasTransport::viscosity()
         //   been named in this specific way.  They are perhaps the most obvious
         //   names, butit would of course be preferred to have a more general
         //   approach, here.
-        std::vector<std::string> spnames = m_thermo->speciesNames();
-        if (spnames[i] == "He") {
+        std::string name = m_thermo->speciesName(i);
+        if (name == "He") {
             FQ_mix_o += molefracs[i]*FQ_i(1.38,Tr,m_mw[i]);
-        } else if (spnames[i] == "H2") {
+        } else if (name == "H2") {
             FQ_mix_o += molefracs[i]*(FQ_i(0.76,Tr,m_mw[i]));
-        } else if (spnames[i] == "D2") {
+        } else if (name == "D2") {
             FQ_mix_o += molefracs[i]*(FQ_i(0.52,Tr,m_mw[i]));
         } else {
             FQ_mix_o += molefracs[i];
@@ -388,59 +407,36 @@ doublereal HighPressureGasTransport::viscosity()
             *(1/Y - 0.007*pow(log(Y),4)))/(ksi*FP_mix_o*FQ_mix_o);
 }
 
+void HighPressureGasTransport::setPureSpecies(size_t i)
+{
+    vector_fp x(m_nsp, 0.0);
+    x[i] = 1.0;
+    m_thermo->setMoleFractions(x.data());
+}
+
 // Pure species critical properties - Tc, Pc, Vc, Zc:
 doublereal HighPressureGasTransport::Tcrit_i(size_t i)
 {
-    // Store current molefracs and set temp molefrac of species i to 1.0:
-    vector_fp molefracs = store(i, m_thermo->nSpecies());
-
-    double tc = m_thermo->critTemperature();
-    // Restore actual molefracs:
-    m_thermo->setMoleFractions(&molefracs[0]);
-    return tc;
+    setPureSpecies(i);
+    return m_thermo->critTemperature();
 }
 
 doublereal HighPressureGasTransport::Pcrit_i(size_t i)
 {
-    // Store current molefracs and set temp molefrac of species i to 1.0:
-    vector_fp molefracs = store(i, m_thermo->nSpecies());
-
-    double pc = m_thermo->critPressure();
-    // Restore actual molefracs:
-    m_thermo->setMoleFractions(&molefracs[0]);
-    return pc;
+    setPureSpecies(i);
+    return m_thermo->critPressure();
 }
 
 doublereal HighPressureGasTransport::Vcrit_i(size_t i)
 {
-    // Store current molefracs and set temp molefrac of species i to 1.0:
-    vector_fp molefracs = store(i, m_thermo->nSpecies());
-
-    double vc = m_thermo->critVolume();
-    // Restore actual molefracs:
-    m_thermo->setMoleFractions(&molefracs[0]);
-    return vc;
+    setPureSpecies(i);
+    return m_thermo->critVolume();
 }
 
 doublereal HighPressureGasTransport::Zcrit_i(size_t i)
 {
-    // Store current molefracs and set temp molefrac of species i to 1.0:
-    vector_fp molefracs = store(i, m_thermo->nSpecies());
-
-    double zc = m_thermo->critCompressibility();
-    // Restore actual molefracs:
-    m_thermo->setMoleFractions(&molefracs[0]);
-    return zc;
-}
-
-vector_fp HighPressureGasTransport::store(size_t i, size_t nsp)
-{
-    vector_fp molefracs(nsp);
-    m_thermo->getMoleFractions(&molefracs[0]);
-    vector_fp mf_temp(nsp, 0.0);
-    mf_temp[i] = 1;
-    m_thermo->setMoleFractions(&mf_temp[0]);
-    return molefracs;
+    setPureSpecies(i);
+    return m_thermo->critCompressibility();
 }
 
 // Calculates quantum correction term for a species based on Tr and MW, used in
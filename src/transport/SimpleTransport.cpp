@@ -157,7 +157,7 @@ bool SimpleTransport::initLiquid(LiquidTransportParams& tr)
 
     // Read the transport block in the phase XML Node
     // It's not an error if this block doesn't exist. Just use the defaults
-    XML_Node& phaseNode = m_thermo->xml();
+    const XML_Node& phaseNode = m_thermo->xml();
     if (phaseNode.hasChild("transport")) {
         XML_Node& transportNode = phaseNode.child("transport");
         string transportModel = transportNode.attrib("model");
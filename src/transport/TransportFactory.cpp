@@ -218,7 +218,7 @@ Transport* TransportFactory::newTransport(const std::string& transportModel,
 Transport* TransportFactory::newTransport(thermo_t* phase, int log_level)
 {
     std::string transportModel = "None";
-    XML_Node& phaseNode = phase->xml();
+    const XML_Node& phaseNode = phase->xml();
     if (phaseNode.hasChild("transport")) {
         transportModel = phaseNode.child("transport").attrib("model");
     }
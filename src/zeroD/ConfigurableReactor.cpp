@@ -0,0 +1,243 @@
+//! @file ConfigurableReactor.cpp
+
+#include "cantera/zeroD/ConfigurableReactor.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/numerics/Func1.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+ConfigurableReactor::ConfigurableReactor(ThermoPhase& thermo, Kinetics* kin) :
+    m_thermo(thermo),
+    m_kin(kin),
+    m_volumeLaw(ConstantPressure),
+    m_volumeFunc(0),
+    m_volumeRate(0),
+    m_heatLoss(0),
+    m_energy(true),
+    m_time(0.0),
+    m_init(false),
+    m_nv(0),
+    m_rtol(1.0e-9),
+    m_atol(1.0e-15),
+    m_maxstep(0.0),
+    m_mass(0.0),
+    m_volume(1.0),
+    m_pressure(0.0)
+{
+    if (kin && &kin->thermo(0) != &thermo) {
+        throw CanteraError("ConfigurableReactor::ConfigurableReactor",
+            "The first phase of the kinetics manager must be the reactor "
+            "contents");
+    }
+}
+
+ConfigurableReactor::~ConfigurableReactor()
+{
+}
+
+void ConfigurableReactor::setConstantPressure()
+{
+    m_volumeLaw = ConstantPressure;
+    m_init = false;
+}
+
+void ConfigurableReactor::setConstantVolume(double V)
+{
+    if (V <= 0.0) {
+        throw CanteraError("ConfigurableReactor::setConstantVolume",
+                           "Volume must be positive. Got {}", V);
+    }
+    m_volumeLaw = ConstantVolume;
+    m_volume = V;
+    m_init = false;
+}
+
+void ConfigurableReactor::setVolumeFunction(Func1* V, Func1* dVdt)
+{
+    if (!V || !dVdt) {
+        throw CanteraError("ConfigurableReactor::setVolumeFunction",
+                           "Both the volume and its rate of change must be "
+                           "specified");
+    }
+    m_volumeLaw = PrescribedVolume;
+    m_volumeFunc = V;
+    m_volumeRate = dVdt;
+    m_init = false;
+}
+
+void ConfigurableReactor::setInitialVolume(double V)
+{
+    if (V <= 0.0) {
+        throw CanteraError("ConfigurableReactor::setInitialVolume",
+                           "Volume must be positive. Got {}", V);
+    }
+    m_volume = V;
+    m_init = false;
+}
+
+void ConfigurableReactor::setSpeciesSource(size_t k, Func1* s)
+{
+    m_thermo.checkSpeciesIndex(k);
+    for (size_t i = 0; i < m_sourceIndex.size(); i++) {
+        if (m_sourceIndex[i] == k) {
+            m_sourceFunc[i] = s;
+            return;
+        }
+    }
+    m_sourceIndex.push_back(k);
+    m_sourceFunc.push_back(s);
+}
+
+void ConfigurableReactor::clearSpeciesSources()
+{
+    m_sourceIndex.clear();
+    m_sourceFunc.clear();
+    fill(m_sdot.begin(), m_sdot.end(), 0.0);
+}
+
+void ConfigurableReactor::setTolerances(double rtol, double atol)
+{
+    if (rtol >= 0.0) {
+        m_rtol = rtol;
+    }
+    if (atol >= 0.0) {
+        m_atol = atol;
+    }
+    m_init = false;
+}
+
+void ConfigurableReactor::setMaxTimeStep(double maxstep)
+{
+    m_maxstep = maxstep;
+    m_init = false;
+}
+
+void ConfigurableReactor::setInitialTime(double t)
+{
+    m_time = t;
+    m_init = false;
+}
+
+void ConfigurableReactor::initialize(double t0)
+{
+    m_time = t0;
+    size_t nsp = m_thermo.nSpecies();
+    m_nv = nsp + 2;
+    m_wdot.assign(nsp, 0.0);
+    m_sdot.assign(nsp, 0.0);
+    m_work.resize(nsp);
+    m_work2.resize(nsp);
+
+    if (m_volumeLaw == PrescribedVolume) {
+        m_volume = m_volumeFunc->eval(t0);
+    }
+    m_pressure = m_thermo.pressure();
+    m_mass = m_thermo.density() * m_volume;
+
+    if (!m_integ) {
+        m_integ.reset(newIntegrator("CVODE"));
+        // use backward differencing, with a full Jacobian computed
+        // numerically, and use a Newton linear iterator
+        m_integ->setMethod(BDF_Method);
+        m_integ->setProblemType(DENSE + NOJAC);
+        m_integ->setIterator(Newton_Iter);
+    }
+    m_integ->setTolerances(m_rtol, m_atol);
+    m_integ->setMaxStepSize(m_maxstep);
+    m_integ->initialize(m_time, *this);
+    m_init = true;
+}
+
+void ConfigurableReactor::advance(double t)
+{
+    if (!m_init) {
+        initialize(m_time);
+    }
+    m_integ->integrate(t);
+    m_time = t;
+    updateState(t, m_integ->solution());
+}
+
+void ConfigurableReactor::getState(double* y)
+{
+    y[0] = m_mass;
+    y[1] = m_thermo.temperature();
+    m_thermo.getMassFractions(y + 2);
+}
+
+void ConfigurableReactor::updateState(double t, const double* y)
+{
+    m_mass = y[0];
+    m_thermo.setMassFractions_NoNorm(y + 2);
+    if (m_volumeLaw == ConstantPressure) {
+        m_thermo.setState_TP(y[1], m_pressure);
+        m_volume = m_mass / m_thermo.density();
+    } else {
+        if (m_volumeLaw == PrescribedVolume) {
+            m_volume = m_volumeFunc->eval(t);
+        }
+        m_thermo.setState_TR(y[1], m_mass / m_volume);
+    }
+}
+
+void ConfigurableReactor::eval(double t, double* y, double* ydot, double* p)
+{
+    updateState(t, y);
+    size_t nsp = m_thermo.nSpecies();
+    const vector_fp& mw = m_thermo.molecularWeights();
+    const double* Y = y + 2;
+
+    if (m_kin) {
+        m_kin->getNetProductionRates(m_wdot.data());
+    }
+    for (size_t i = 0; i < m_sourceIndex.size(); i++) {
+        m_sdot[m_sourceIndex[i]] = m_sourceFunc[i]->eval(t);
+    }
+
+    // mass added by the species sources
+    double dmdt = 0.0;
+    for (size_t i = 0; i < m_sourceIndex.size(); i++) {
+        size_t k = m_sourceIndex[i];
+        dmdt += m_volume * m_sdot[k] * mw[k];
+    }
+    ydot[0] = dmdt;
+
+    for (size_t k = 0; k < nsp; k++) {
+        ydot[k+2] = (m_volume * (m_wdot[k] + m_sdot[k]) * mw[k]
+                     - Y[k] * dmdt) / m_mass;
+    }
+
+    if (!m_energy) {
+        ydot[1] = 0.0;
+        return;
+    }
+    double Q = (m_heatLoss) ? m_heatLoss->eval(t) : 0.0;
+    if (m_volumeLaw == ConstantPressure) {
+        // Sources add species at the enthalpy of the reactor contents, so
+        // only the chemical heat release changes the temperature
+        m_thermo.getPartialMolarEnthalpies(m_work.data());
+        double hdot = 0.0;
+        for (size_t k = 0; k < nsp; k++) {
+            hdot += m_work[k] * m_wdot[k];
+        }
+        ydot[1] = (-Q - m_volume * hdot) / (m_mass * m_thermo.cp_mass());
+    } else {
+        m_thermo.getPartialMolarEnthalpies(m_work.data());
+        m_thermo.getPartialMolarIntEnergies(m_work2.data());
+        double udot = 0.0;
+        for (size_t k = 0; k < nsp; k++) {
+            udot += m_work2[k] * m_wdot[k]
+                    - (m_work[k] - m_work2[k]) * m_sdot[k];
+        }
+        double dVdt = (m_volumeLaw == PrescribedVolume) ?
+                      m_volumeRate->eval(t) : 0.0;
+        ydot[1] = (-m_thermo.pressure() * dVdt - Q - m_volume * udot)
+                  / (m_mass * m_thermo.cv_mass());
+    }
+}
+
+}
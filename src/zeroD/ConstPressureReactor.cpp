@@ -165,10 +165,10 @@ std::string ConstPressureReactor::componentName(size_t k) {
         }
         for (auto& S : m_surfaces) {
             ThermoPhase* th = S->thermo();
-            if (k < th->nSpecies()) {
+            if (k < S->neq()) {
                 return th->speciesName(k);
             } else {
-                k -= th->nSpecies();
+                k -= S->neq();
             }
         }
     }
@@ -0,0 +1,518 @@
+//! @file CoupledReactorNet.cpp
+
+#include "cantera/zeroD/CoupledReactorNet.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/zeroD/Reservoir.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <set>
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+#include <cstdint>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <thread>
+#include <chrono>
+#endif
+
+using namespace std;
+
+namespace Cantera
+{
+
+double reactorCost(size_t nSpecies, size_t nReactions)
+{
+    double nv = nSpecies + 3.0;
+    return nv * (nv + nReactions);
+}
+
+vector<size_t> partitionReactorGraph(const vector_fp& weights,
+                                     const vector<pair<size_t, size_t> >& edges,
+                                     size_t nParts, double imbalance)
+{
+    size_t n = weights.size();
+    if (nParts == 0 || nParts > n) {
+        throw CanteraError("partitionReactorGraph", "Cannot divide {} "
+                           "reactors into {} sub-networks", n, nParts);
+    }
+    vector<vector<size_t> > adj(n);
+    for (const auto& e : edges) {
+        if (e.first >= n || e.second >= n) {
+            throw IndexError("partitionReactorGraph", "edges",
+                             std::max(e.first, e.second), n-1);
+        }
+        if (e.first != e.second) {
+            adj[e.first].push_back(e.second);
+            adj[e.second].push_back(e.first);
+        }
+    }
+
+    vector<size_t> part(n, npos);
+    vector_fp partWeight(nParts, 0.0);
+    vector<size_t> partSize(nParts, 0);
+    double remaining = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        remaining += weights[i];
+    }
+    double average = remaining / nParts;
+    size_t nFree = n;
+
+    // Grow the partitions one at a time. 'conn' is the number of edges
+    // between each unassigned reactor and the current partition, and
+    // 'frontier' contains the unassigned reactors with at least one such edge,
+    // ordered by decreasing number of edges.
+    vector<int> conn(n, 0);
+    set<pair<int, size_t> > frontier;
+    for (size_t p = 0; p + 1 < nParts; p++) {
+        double target = remaining / (nParts - p);
+        fill(conn.begin(), conn.end(), 0);
+        frontier.clear();
+        while (nFree > nParts - p - 1) {
+            size_t v;
+            if (!frontier.empty()) {
+                v = frontier.begin()->second;
+            } else {
+                // Start from the unassigned reactor with the fewest unassigned
+                // neighbors, which is on the periphery of the remaining graph
+                v = npos;
+                size_t minDegree = npos;
+                for (size_t i = 0; i < n; i++) {
+                    if (part[i] != npos) {
+                        continue;
+                    }
+                    size_t degree = 0;
+                    for (size_t j : adj[i]) {
+                        degree += (part[j] == npos);
+                    }
+                    if (degree < minDegree) {
+                        minDegree = degree;
+                        v = i;
+                    }
+                }
+            }
+            // Stop if adding this reactor would overshoot the target by more
+            // than stopping short of it
+            if (partSize[p] && partWeight[p] + weights[v] - target >
+                target - partWeight[p]) {
+                break;
+            }
+            frontier.erase(make_pair(-conn[v], v));
+            part[v] = p;
+            partWeight[p] += weights[v];
+            partSize[p]++;
+            nFree--;
+            for (size_t j : adj[v]) {
+                if (part[j] == npos) {
+                    frontier.erase(make_pair(-conn[j], j));
+                    conn[j]++;
+                    frontier.insert(make_pair(-conn[j], j));
+                }
+            }
+            if (partWeight[p] >= target) {
+                break;
+            }
+        }
+        remaining -= partWeight[p];
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (part[i] == npos) {
+            part[i] = nParts - 1;
+            partWeight[nParts - 1] += weights[i];
+            partSize[nParts - 1]++;
+        }
+    }
+
+    // Move reactors on the boundaries between partitions to the adjacent
+    // partition with the most connections, if this reduces the number of
+    // edges between partitions
+    double maxWeight = (1.0 + imbalance) * average;
+    vector<int> count(nParts, 0);
+    for (int pass = 0; pass < 10; pass++) {
+        bool moved = false;
+        for (size_t v = 0; v < n; v++) {
+            size_t a = part[v];
+            for (size_t j : adj[v]) {
+                count[part[j]]++;
+            }
+            size_t best = a;
+            for (size_t j : adj[v]) {
+                size_t b = part[j];
+                if (b != a && count[b] > count[a] &&
+                    (best == a || count[b] > count[best]) &&
+                    partWeight[b] + weights[v] <= maxWeight) {
+                    best = b;
+                }
+            }
+            for (size_t j : adj[v]) {
+                count[part[j]] = 0;
+            }
+            if (best != a && partSize[a] > 1) {
+                part[v] = best;
+                partWeight[a] -= weights[v];
+                partWeight[best] += weights[v];
+                partSize[a]--;
+                partSize[best]++;
+                moved = true;
+            }
+        }
+        if (!moved) {
+            break;
+        }
+    }
+    return part;
+}
+
+#ifndef _WIN32
+
+namespace {
+
+string errorString()
+{
+    return strerror(errno);
+}
+
+sockaddr_un socketAddress(const string& method, const string& path)
+{
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) {
+        throw CanteraError(method, "Socket path '{}' is too long", path);
+    }
+    strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    return addr;
+}
+
+}
+
+SocketChannel::SocketChannel(int fd) :
+    m_fd(fd)
+{
+}
+
+SocketChannel::~SocketChannel()
+{
+    ::close(m_fd);
+}
+
+SocketChannel* SocketChannel::accept(const string& path)
+{
+    sockaddr_un addr = socketAddress("SocketChannel::accept", path);
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        throw CanteraError("SocketChannel::accept", errorString());
+    }
+    ::unlink(path.c_str());
+    if (::bind(fd, (sockaddr*) &addr, sizeof(addr)) < 0 ||
+        ::listen(fd, 1) < 0) {
+        string msg = errorString();
+        ::close(fd);
+        throw CanteraError("SocketChannel::accept",
+                           "Unable to listen on '{}': {}", path, msg);
+    }
+    int conn;
+    do {
+        conn = ::accept(fd, 0, 0);
+    } while (conn < 0 && errno == EINTR);
+    string msg = errorString();
+    ::close(fd);
+    ::unlink(path.c_str());
+    if (conn < 0) {
+        throw CanteraError("SocketChannel::accept", msg);
+    }
+    return new SocketChannel(conn);
+}
+
+SocketChannel* SocketChannel::connect(const string& path, double timeout)
+{
+    sockaddr_un addr = socketAddress("SocketChannel::connect", path);
+    auto t0 = std::chrono::steady_clock::now();
+    while (true) {
+        int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) {
+            throw CanteraError("SocketChannel::connect", errorString());
+        }
+        if (::connect(fd, (sockaddr*) &addr, sizeof(addr)) == 0) {
+            return new SocketChannel(fd);
+        }
+        int err = errno;
+        string msg = errorString();
+        ::close(fd);
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - t0;
+        if ((err != ENOENT && err != ECONNREFUSED && err != EINTR) ||
+            elapsed.count() > timeout) {
+            throw CanteraError("SocketChannel::connect",
+                               "Unable to connect to '{}': {}", path, msg);
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+void SocketChannel::send(const double* data, size_t n)
+{
+#ifdef MSG_NOSIGNAL
+    const int flags = MSG_NOSIGNAL;
+#else
+    const int flags = 0;
+#endif
+    // Each message is the number of values, followed by the values
+    uint64_t len = n;
+    const char* parts[2] = {(const char*) &len, (const char*) data};
+    size_t sizes[2] = {sizeof(len), n * sizeof(double)};
+    for (size_t i = 0; i < 2; i++) {
+        size_t done = 0;
+        while (done < sizes[i]) {
+            ssize_t m = ::send(m_fd, parts[i] + done, sizes[i] - done, flags);
+            if (m < 0 && errno == EINTR) {
+                continue;
+            } else if (m < 0) {
+                throw CanteraError("SocketChannel::send", errorString());
+            }
+            done += m;
+        }
+    }
+}
+
+void SocketChannel::receive(vector_fp& data)
+{
+    uint64_t len = 0;
+    for (size_t i = 0; i < 2; i++) {
+        char* buf = (i == 0) ? (char*) &len : (char*) data.data();
+        size_t size = (i == 0) ? sizeof(len) : len * sizeof(double);
+        size_t done = 0;
+        while (done < size) {
+            ssize_t m = ::recv(m_fd, buf + done, size - done, 0);
+            if (m < 0 && errno == EINTR) {
+                continue;
+            } else if (m < 0) {
+                throw CanteraError("SocketChannel::receive", errorString());
+            } else if (m == 0) {
+                throw CanteraError("SocketChannel::receive",
+                                   "Connection closed by peer");
+            }
+            done += m;
+        }
+        if (i == 0) {
+            data.resize(len);
+        }
+    }
+}
+
+#endif
+
+CoupledReactorNet::CoupledReactorNet(ReactorNet& net, int rank) :
+    m_net(net),
+    m_rank(rank),
+    m_time(0.0),
+    m_interval(0.0),
+    m_iterations(1),
+    m_gaussSeidel(false),
+    m_init(false),
+    m_residual(0.0)
+{
+}
+
+size_t CoupledReactorNet::addPeer(CouplingChannel& channel, int rank)
+{
+    if (rank == m_rank) {
+        throw CanteraError("CoupledReactorNet::addPeer",
+                           "Peer has the same rank as this sub-network");
+    }
+    for (const auto& peer : m_peers) {
+        if (peer.rank == rank) {
+            throw CanteraError("CoupledReactorNet::addPeer",
+                               "Duplicate peer with rank {}", rank);
+        }
+    }
+    Peer peer;
+    peer.channel = &channel;
+    peer.rank = rank;
+    m_peers.push_back(peer);
+    m_order.push_back(m_peers.size() - 1);
+    sort(m_order.begin(), m_order.end(), [this](size_t i, size_t j) {
+        return m_peers[i].rank < m_peers[j].rank;
+    });
+    return m_peers.size() - 1;
+}
+
+void CoupledReactorNet::addExport(ReactorBase& r, size_t peer, int tag)
+{
+    if (peer >= m_peers.size()) {
+        throw IndexError("CoupledReactorNet::addExport", "peers", peer,
+                         m_peers.size()-1);
+    }
+    m_peers[peer].exports.push_back(make_pair(tag, &r));
+}
+
+void CoupledReactorNet::addImport(Reservoir& ghost, size_t peer, int tag)
+{
+    if (peer >= m_peers.size()) {
+        throw IndexError("CoupledReactorNet::addImport", "peers", peer,
+                         m_peers.size()-1);
+    }
+    if (m_peers[peer].imports.count(tag)) {
+        throw CanteraError("CoupledReactorNet::addImport",
+                           "Duplicate tag {} for peer {}", tag, peer);
+    }
+    m_peers[peer].imports[tag] = &ghost;
+}
+
+void CoupledReactorNet::setCouplingInterval(double dt)
+{
+    if (dt <= 0.0) {
+        throw CanteraError("CoupledReactorNet::setCouplingInterval",
+                           "Coupling interval must be positive");
+    }
+    m_interval = dt;
+}
+
+void CoupledReactorNet::setCouplingIterations(size_t n)
+{
+    if (n == 0) {
+        throw CanteraError("CoupledReactorNet::setCouplingIterations",
+                           "At least one iteration is required");
+    }
+    m_iterations = n;
+}
+
+void CoupledReactorNet::advance(double t)
+{
+    if (m_interval <= 0.0) {
+        throw CanteraError("CoupledReactorNet::advance",
+                           "Coupling interval has not been set");
+    }
+    if (!m_init) {
+        // Initialize the ghosts with the initial states of the remote reactors
+        m_time = m_net.time();
+        exchangeStates();
+        m_net.reinitialize();
+        m_residual = 0.0;
+        m_init = true;
+    }
+    while (t - m_time > 1e-9 * m_interval) {
+        integrateInterval(m_time + m_interval);
+    }
+}
+
+void CoupledReactorNet::integrateInterval(double t1)
+{
+    if (m_iterations > 1) {
+        m_y0.resize(m_net.neq());
+        m_net.getState(m_y0.data());
+    }
+    for (size_t iter = 0; iter < m_iterations; iter++) {
+        m_residual = 0.0;
+        if (iter > 0) {
+            m_net.updateState(m_y0.data());
+            m_net.setInitialTime(m_time);
+        }
+        if (m_gaussSeidel) {
+            for (size_t i : m_order) {
+                if (m_peers[i].rank < m_rank) {
+                    receiveStates(m_peers[i]);
+                }
+            }
+            m_net.advance(t1);
+            for (size_t i : m_order) {
+                sendStates(m_peers[i]);
+            }
+            for (size_t i : m_order) {
+                if (m_peers[i].rank > m_rank) {
+                    receiveStates(m_peers[i]);
+                }
+            }
+        } else {
+            m_net.advance(t1);
+            exchangeStates();
+        }
+    }
+    m_time = t1;
+}
+
+void CoupledReactorNet::exchangeStates()
+{
+    // Each pair of processes exchanges messages in the order of their ranks,
+    // so that a process never waits to send to a process which is itself
+    // waiting to send.
+    for (size_t i : m_order) {
+        Peer& peer = m_peers[i];
+        if (peer.rank < m_rank) {
+            receiveStates(peer);
+            sendStates(peer);
+        } else {
+            sendStates(peer);
+            receiveStates(peer);
+        }
+    }
+}
+
+void CoupledReactorNet::sendStates(Peer& peer)
+{
+    // The message contains the tag, the length and the values of each state
+    m_buf.clear();
+    for (const auto& item : peer.exports) {
+        const ReactorBase& r = *item.second;
+        size_t nsp = r.contents().nSpecies();
+        m_buf.push_back(item.first);
+        m_buf.push_back(nsp + 2.0);
+        m_buf.push_back(r.temperature());
+        m_buf.push_back(r.density());
+        m_buf.insert(m_buf.end(), r.massFractions(), r.massFractions() + nsp);
+    }
+    peer.channel->send(m_buf.data(), m_buf.size());
+}
+
+void CoupledReactorNet::receiveStates(Peer& peer)
+{
+    peer.channel->receive(m_buf);
+    size_t loc = 0;
+    size_t nReceived = 0;
+    while (loc + 2 <= m_buf.size()) {
+        int tag = static_cast<int>(m_buf[loc]);
+        size_t len = static_cast<size_t>(m_buf[loc+1]);
+        if (len > m_buf.size() - loc - 2) {
+            break;
+        }
+        const double* state = m_buf.data() + loc + 2;
+        loc += len + 2;
+        auto iter = peer.imports.find(tag);
+        if (iter == peer.imports.end()) {
+            continue;
+        }
+        Reservoir& ghost = *iter->second;
+        ThermoPhase& phase = ghost.contents();
+        if (len != phase.nSpecies() + 2) {
+            throw CanteraError("CoupledReactorNet::receiveStates",
+                "State with tag {} from rank {} has {} species instead of {}",
+                tag, peer.rank, len - 2, phase.nSpecies());
+        }
+        double change = std::max(
+            fabs(state[0] - ghost.temperature()) / ghost.temperature(),
+            fabs(state[1] - ghost.density()) / ghost.density());
+        for (size_t k = 0; k < phase.nSpecies(); k++) {
+            change = std::max(change,
+                              fabs(state[k+2] - ghost.massFraction(k)));
+        }
+        m_residual = std::max(m_residual, change);
+        phase.restoreState(len, state);
+        ghost.syncState();
+        nReceived++;
+    }
+    if (loc != m_buf.size()) {
+        throw CanteraError("CoupledReactorNet::receiveStates",
+                           "Malformed message from rank {}", peer.rank);
+    }
+    if (nReceived != peer.imports.size()) {
+        throw CanteraError("CoupledReactorNet::receiveStates", "Received {} "
+            "of {} states from rank {}", nReceived, peer.imports.size(),
+            peer.rank);
+    }
+    m_net.setNeedsReinit();
+}
+
+}
@@ -0,0 +1,216 @@
+//! @file ElectrodeReactor.cpp A zero-dimensional electrode particle model
+
+#include "cantera/zeroD/ElectrodeReactor.h"
+#include "cantera/zeroD/ReactorSurface.h"
+#include "cantera/thermo/SurfPhase.h"
+#include "cantera/kinetics/InterfaceKinetics.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+ElectrodeReactor::ElectrodeReactor() :
+    m_current(0.0),
+    m_capacitance(0.2),
+    m_phi(0.0)
+{
+    m_energy = false;
+}
+
+void ElectrodeReactor::setDoubleLayerCapacitance(double C)
+{
+    if (C <= 0.0) {
+        throw CanteraError("ElectrodeReactor::setDoubleLayerCapacitance",
+                           "Capacitance must be positive. Got {}", C);
+    }
+    m_capacitance = C;
+}
+
+double ElectrodeReactor::surfaceArea() const
+{
+    double A = 0.0;
+    for (auto S : m_surfaces) {
+        A += S->area();
+    }
+    return A;
+}
+
+void ElectrodeReactor::getState(double* y)
+{
+    if (m_thermo == 0) {
+        throw CanteraError("ElectrodeReactor::getState",
+                           "Error: reactor is empty.");
+    }
+    m_thermo->restoreState(m_state);
+
+    // the first component is the electric potential of the electrode
+    y[0] = m_phi;
+
+    // the remaining components are the surface species coverages
+    getSurfaceInitialConditions(y + 1);
+}
+
+void ElectrodeReactor::initialize(doublereal t0)
+{
+    if (!m_thermo) {
+        throw CanteraError("ElectrodeReactor::initialize", "Reactor contents"
+                " not set for reactor '" + m_name + "'.");
+    }
+    if (!m_wall.empty()) {
+        throw CanteraError("ElectrodeReactor::initialize", "Walls are not"
+                " supported by reactor '" + m_name + "'.");
+    }
+    if (m_surfaces.empty()) {
+        throw CanteraError("ElectrodeReactor::initialize", "No surfaces"
+                " installed on reactor '" + m_name + "'.");
+    }
+    m_thermo->restoreState(m_state);
+    m_phi = m_thermo->electricPotential();
+    m_sdot.resize(m_nsp, 0.0);
+
+    m_enthalpy = m_thermo->enthalpy_mass();
+    m_pressure = m_thermo->pressure();
+    m_intEnergy = m_thermo->intEnergy_mass();
+
+    m_nv = 1;
+    size_t maxnt = 0;
+    m_surfKin.clear();
+    for (auto S : m_surfaces) {
+        InterfaceKinetics* kin = dynamic_cast<InterfaceKinetics*>(S->kinetics());
+        if (!kin) {
+            throw CanteraError("ElectrodeReactor::initialize",
+                "Surface kinetics managers must be of type InterfaceKinetics.");
+        }
+        if (&kin->thermo(0) != m_thermo) {
+            throw CanteraError("ElectrodeReactor::initialize",
+                "First phase of all kinetics managers must be the electrode.");
+        }
+        m_surfKin.push_back(kin);
+        m_nv += S->neq();
+        maxnt = std::max(maxnt, kin->nTotalSpecies());
+    }
+    m_work.resize(maxnt);
+}
+
+void ElectrodeReactor::updateState(doublereal* y)
+{
+    m_phi = y[0];
+    m_thermo->setElectricPotential(m_phi);
+    updateSurfaceState(y + 1);
+}
+
+void ElectrodeReactor::syncPhases()
+{
+    m_thermo->restoreState(m_state);
+    m_thermo->setElectricPotential(m_phi);
+    for (auto S : m_surfaces) {
+        S->thermo()->setTemperature(m_state[0]);
+        S->syncCoverages();
+    }
+}
+
+double ElectrodeReactor::faradaicCurrent()
+{
+    if (m_surfKin.size() != m_surfaces.size()) {
+        initialize();
+    }
+    syncPhases();
+    double I = 0.0;
+    for (size_t n = 0; n < m_surfaces.size(); n++) {
+        I -= m_surfaces[n]->area() * m_surfKin[n]->currentDensity(0);
+    }
+    return I;
+}
+
+double ElectrodeReactor::faradaicCurrent_ddPhi()
+{
+    if (m_surfKin.size() != m_surfaces.size()) {
+        initialize();
+    }
+    syncPhases();
+    double dIdphi = 0.0;
+    for (size_t n = 0; n < m_surfaces.size(); n++) {
+        dIdphi -= m_surfaces[n]->area() * m_surfKin[n]->currentDensity_ddPhi(0, 0);
+    }
+    return dIdphi;
+}
+
+void ElectrodeReactor::evalEqs(doublereal time, doublereal* y,
+                               doublereal* ydot, doublereal* params)
+{
+    m_thermo->restoreState(m_state);
+    m_thermo->setElectricPotential(m_phi);
+    applySensitivity(params);
+
+    // Rates of change of the surface coverages. This also brings the rates of
+    // progress of the surface reactions up to date.
+    evalSurfaces(time, ydot + 1);
+
+    // Charging of the double layer
+    double I_F = 0.0;
+    for (size_t n = 0; n < m_surfaces.size(); n++) {
+        I_F -= m_surfaces[n]->area() * m_surfKin[n]->currentDensity(0);
+    }
+    ydot[0] = (m_current - I_F) / (m_capacitance * surfaceArea());
+
+    resetSensitivity(params);
+}
+
+void ElectrodeReactor::addSensitivityReaction(size_t rxn)
+{
+    throw CanteraError("ElectrodeReactor::addSensitivityReaction",
+        "The electrode phase has no homogeneous reactions. Use "
+        "ReactorSurface::addSensitivityReaction instead.");
+}
+
+size_t ElectrodeReactor::speciesIndex(const string& nm) const
+{
+    size_t offset = 0;
+    for (auto& S : m_surfaces) {
+        if (S->pseudoSteadyState()) {
+            continue;
+        }
+        ThermoPhase* th = S->thermo();
+        size_t k = th->speciesIndex(nm);
+        if (k != npos) {
+            return k + offset;
+        } else {
+            offset += th->nSpecies();
+        }
+    }
+    return npos;
+}
+
+size_t ElectrodeReactor::componentIndex(const string& nm) const
+{
+    size_t k = speciesIndex(nm);
+    if (k != npos) {
+        return k + 1;
+    } else if (nm == "potential") {
+        return 0;
+    } else {
+        return npos;
+    }
+}
+
+std::string ElectrodeReactor::componentName(size_t k)
+{
+    if (k == 0) {
+        return "potential";
+    } else if (k < neq()) {
+        k -= 1;
+        for (auto& S : m_surfaces) {
+            ThermoPhase* th = S->thermo();
+            if (k < S->neq()) {
+                return th->speciesName(k);
+            } else {
+                k -= S->neq();
+            }
+        }
+    }
+    throw CanteraError("ElectrodeReactor::componentName",
+                       "Index is out of bounds.");
+}
+
+}
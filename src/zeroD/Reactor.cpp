@@ -72,8 +72,10 @@ void Reactor::getSurfaceInitialConditions(double* y)
 {
     size_t loc = 0;
     for (auto& S : m_surfaces) {
-        S->getCoverages(y + loc);
-        loc += S->thermo()->nSpecies();
+        if (!S->pseudoSteadyState()) {
+            S->getCoverages(y + loc);
+        }
+        loc += S->neq();
     }
 }
 
@@ -102,7 +104,7 @@ void Reactor::initialize(doublereal t0)
     m_nv = m_nsp + 3;
     size_t maxnt = 0;
     for (auto& S : m_surfaces) {
-        m_nv += S->thermo()->nSpecies();
+        m_nv += S->neq();
         size_t nt = S->kinetics()->nTotalSpecies();
         maxnt = std::max(maxnt, nt);
         if (&m_kin->thermo(0) != &S->kinetics()->thermo(0)) {
@@ -187,8 +189,10 @@ void Reactor::updateSurfaceState(double* y)
 {
     size_t loc = 0;
     for (auto& S : m_surfaces) {
-        S->setCoverages(y+loc);
-        loc += S->thermo()->nSpecies();
+        if (!S->pseudoSteadyState()) {
+            S->setCoverages(y+loc);
+        }
+        loc += S->neq();
     }
 }
 
@@ -280,20 +284,26 @@ double Reactor::evalSurfaces(double t, double* ydot)
         Kinetics* kin = S->kinetics();
         SurfPhase* surf = S->thermo();
 
-        double rs0 = 1.0/surf->siteDensity();
-        size_t nk = surf->nSpecies();
-        double sum = 0.0;
         surf->setTemperature(m_state[0]);
-        S->syncCoverages();
-        kin->getNetProductionRates(&m_work[0]);
-        size_t ns = kin->surfacePhaseIndex();
-        size_t surfloc = kin->kineticsSpeciesIndex(0,ns);
-        for (size_t k = 1; k < nk; k++) {
-            ydot[loc + k] = m_work[surfloc+k]*rs0*surf->size(k);
-            sum -= ydot[loc + k];
+        if (S->pseudoSteadyState()) {
+            // coverages are algebraic variables; no equations are added
+            S->solvePseudoSteadyState();
+            kin->getNetProductionRates(&m_work[0]);
+        } else {
+            double rs0 = 1.0/surf->siteDensity();
+            size_t nk = surf->nSpecies();
+            double sum = 0.0;
+            S->syncCoverages();
+            kin->getNetProductionRates(&m_work[0]);
+            size_t ns = kin->surfacePhaseIndex();
+            size_t surfloc = kin->kineticsSpeciesIndex(0,ns);
+            for (size_t k = 1; k < nk; k++) {
+                ydot[loc + k] = m_work[surfloc+k]*rs0*surf->size(k);
+                sum -= ydot[loc + k];
+            }
+            ydot[loc] = sum;
+            loc += nk;
         }
-        ydot[loc] = sum;
-        loc += nk;
 
         double wallarea = S->area();
         for (size_t k = 0; k < m_nsp; k++) {
@@ -343,6 +353,9 @@ size_t Reactor::speciesIndex(const string& nm) const
     // check for a wall species
     size_t offset = m_nsp;
     for (auto& S : m_surfaces) {
+        if (S->pseudoSteadyState()) {
+            continue;
+        }
         ThermoPhase* th = S->thermo();
         k = th->speciesIndex(nm);
         if (k != npos) {
@@ -401,10 +414,10 @@ std::string Reactor::componentName(size_t k) {
         }
         for (auto& S : m_surfaces) {
             ThermoPhase* th = S->thermo();
-            if (k < th->nSpecies()) {
+            if (k < S->neq()) {
                 return th->speciesName(k);
             } else {
-                k -= th->nSpecies();
+                k -= S->neq();
             }
         }
     }
@@ -428,7 +441,9 @@ void Reactor::applySensitivity(double* params)
         S->setSensitivityParameters(params);
     }
     m_thermo->invalidateCache();
-    m_kin->invalidateCache();
+    if (m_kin) {
+        m_kin->invalidateCache();
+    }
 }
 
 void Reactor::resetSensitivity(double* params)
@@ -447,7 +462,9 @@ void Reactor::resetSensitivity(double* params)
         S->resetSensitivityParameters();
     }
     m_thermo->invalidateCache();
-    m_kin->invalidateCache();
+    if (m_kin) {
+        m_kin->invalidateCache();
+    }
 }
 
 }
@@ -9,6 +9,7 @@
 #include "cantera/zeroD/ConstPressureReactor.h"
 #include "cantera/zeroD/IdealGasReactor.h"
 #include "cantera/zeroD/IdealGasConstPressureReactor.h"
+#include "cantera/zeroD/ElectrodeReactor.h"
 
 using namespace std;
 namespace Cantera
@@ -25,6 +26,7 @@ ReactorFactory::ReactorFactory()
     reg("FlowReactor", []() { return new FlowReactor(); });
     reg("IdealGasReactor", []() { return new IdealGasReactor(); });
     reg("IdealGasConstPressureReactor", []() { return new IdealGasConstPressureReactor(); });
+    reg("ElectrodeReactor", []() { return new ElectrodeReactor(); });
 }
 
 ReactorBase* ReactorFactory::newReactor(const std::string& reactorType)
@@ -41,7 +43,8 @@ ReactorBase* ReactorFactory::newReactor(int ir)
         {ConstPressureReactorType, "ConstPressureReactor"},
         {FlowReactorType, "FlowReactor"},
         {IdealGasReactorType, "IdealGasReactor"},
-        {IdealGasConstPressureReactorType, "IdealGasConstPressureReactor"}
+        {IdealGasConstPressureReactorType, "IdealGasConstPressureReactor"},
+        {ElectrodeReactorType, "ElectrodeReactor"}
     };
 
     try {
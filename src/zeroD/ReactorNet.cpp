@@ -99,6 +99,9 @@ void ReactorNet::initialize()
 
     m_ydot.resize(m_nv,0.0);
     m_atol.resize(neq());
+    // Use the Jacobian evaluated by evalJacobian() if additional threads are
+    // available, and the internal finite difference Jacobian otherwise
+    m_integ->setProblemType(m_jacWorkers.empty() ? DENSE + NOJAC : DENSE + JAC);
     fill(m_atol.begin(), m_atol.end(), m_atols);
     m_integ->setTolerances(m_rtol, neq(), m_atol.data());
     m_integ->setSensitivityTolerances(m_rtolsens, m_atolsens);
@@ -165,7 +168,7 @@ void ReactorNet::eval(doublereal t, doublereal* y,
     for (size_t n = 0; n < m_reactors.size(); n++) {
         m_reactors[n]->evalEqs(t, y + m_start[n], ydot + m_start[n], p);
     }
-    checkFinite("ydot", ydot, m_nv);
+    CheckFiniteSampled("ydot", ydot, m_nv);
 }
 
 double ReactorNet::sensitivity(size_t k, size_t p)
@@ -189,10 +192,66 @@ void ReactorNet::evalJacobian(doublereal t, doublereal* y,
 {
     //evaluate the unperturbed ydot
     eval(t, y, ydot, p);
-    for (size_t n = 0; n < m_nv; n++) {
+    if (m_jacWorkers.empty()) {
+        evalJacColumns(t, y, ydot, p, j, m_atol.data(), m_rtol, 0, m_nv);
+        return;
+    }
+
+    for (auto net : m_jacWorkers) {
+        if (!net->m_init) {
+            net->initialize();
+        }
+        if (net->m_nv != m_nv) {
+            throw CanteraError("ReactorNet::evalJacobian", "Jacobian worker "
+                "has {} state variables instead of {}", net->m_nv, m_nv);
+        }
+        if (net->m_paramNames != m_paramNames) {
+            throw CanteraError("ReactorNet::evalJacobian", "Jacobian worker "
+                "has different sensitivity parameters");
+        }
+        net->m_yJac.assign(y, y + m_nv);
+    }
+    size_t nw = m_jacWorkers.size() + 1;
+    if (!m_jacThreads || m_jacThreads->nThreads() != nw) {
+        m_jacThreads.reset(new WorkerThreads(nw));
+    }
+
+    // Divide the columns into contiguous blocks. The first block is evaluated
+    // by this network on the calling thread. Each worker first checks that it
+    // evaluates the same unperturbed time derivative as this network, which
+    // detects differences in reservoirs, walls, flow devices and kinetics.
+    m_jacThreads->run(nw, [&](size_t i) {
+        size_t i0 = (i * m_nv) / nw;
+        size_t i1 = ((i + 1) * m_nv) / nw;
+        if (i == 0) {
+            evalJacColumns(t, y, ydot, p, j, m_atol.data(), m_rtol, i0, i1);
+            return;
+        }
+        ReactorNet* net = m_jacWorkers[i-1];
+        net->eval(t, net->m_yJac.data(), net->m_ydot.data(), p);
+        for (size_t m = 0; m < m_nv; m++) {
+            if (net->m_ydot[m] != ydot[m]) {
+                throw CanteraError("ReactorNet::evalJacobian",
+                    "Jacobian worker {} evaluates a different time derivative "
+                    "for component {} ({}) than the reactor network ({} "
+                    "instead of {})", i - 1, m, componentName(m),
+                    net->m_ydot[m], ydot[m]);
+            }
+        }
+        net->evalJacColumns(t, net->m_yJac.data(), ydot, p, j, m_atol.data(),
+                            m_rtol, i0, i1);
+    });
+}
+
+void ReactorNet::evalJacColumns(doublereal t, doublereal* y,
+                                const doublereal* ydot, doublereal* p,
+                                Array2D* j, const doublereal* atol,
+                                doublereal rtol, size_t c0, size_t c1)
+{
+    for (size_t n = c0; n < c1; n++) {
         // perturb x(n)
         double ysave = y[n];
-        double dy = m_atol[n] + fabs(ysave)*m_rtol;
+        double dy = atol[n] + fabs(ysave)*rtol;
         y[n] = ysave + dy;
         dy = y[n] - ysave;
 
@@ -207,9 +266,26 @@ void ReactorNet::evalJacobian(doublereal t, doublereal* y,
     }
 }
 
+void ReactorNet::addJacobianWorker(ReactorNet& net)
+{
+    if (&net == this) {
+        throw CanteraError("ReactorNet::addJacobianWorker",
+                           "A reactor network cannot be its own Jacobian worker");
+    }
+    m_jacWorkers.push_back(&net);
+    m_init = false;
+}
+
+void ReactorNet::clearJacobianWorkers()
+{
+    m_jacWorkers.clear();
+    m_jacThreads.reset();
+    m_init = false;
+}
+
 void ReactorNet::updateState(doublereal* y)
 {
-    checkFinite("y", y, m_nv);
+    CheckFiniteSampled("y", y, m_nv);
     for (size_t n = 0; n < m_reactors.size(); n++) {
         m_reactors[n]->updateState(y + m_start[n]);
     }
@@ -3,7 +3,7 @@
 #include "cantera/zeroD/ReactorSurface.h"
 #include "cantera/zeroD/ReactorNet.h"
 #include "cantera/thermo/SurfPhase.h"
-#include "cantera/kinetics/Kinetics.h"
+#include "cantera/kinetics/InterfaceKinetics.h"
 
 namespace Cantera
 {
@@ -13,6 +13,7 @@ ReactorSurface::ReactorSurface()
     , m_thermo(nullptr)
     , m_kinetics(nullptr)
     , m_reactor(nullptr)
+    , m_pseudoSteadyState(false)
 {
 }
 
@@ -76,6 +77,41 @@ void ReactorSurface::syncCoverages()
     m_thermo->setCoveragesNoNorm(m_cov.data());
 }
 
+size_t ReactorSurface::neq() const
+{
+    return m_pseudoSteadyState ? 0 : m_cov.size();
+}
+
+void ReactorSurface::solvePseudoSteadyState()
+{
+    InterfaceKinetics* kin = dynamic_cast<InterfaceKinetics*>(m_kinetics);
+    if (!kin) {
+        throw CanteraError("ReactorSurface::solvePseudoSteadyState",
+            "Pseudo-steady state coverages require an InterfaceKinetics "
+            "object.");
+    }
+
+    // The solver sets all phases to a common temperature and pressure, which
+    // may perturb the state of the reactor contents
+    size_t ns = kin->surfacePhaseIndex();
+    m_phaseStates.resize(kin->nPhases());
+    for (size_t n = 0; n < kin->nPhases(); n++) {
+        if (n != ns) {
+            kin->thermo(n).saveState(m_phaseStates[n]);
+        }
+    }
+
+    syncCoverages();
+    kin->solvePseudoSteadyStateProblem();
+    m_thermo->getCoverages(m_cov.data());
+
+    for (size_t n = 0; n < kin->nPhases(); n++) {
+        if (n != ns) {
+            kin->thermo(n).restoreState(m_phaseStates[n]);
+        }
+    }
+}
+
 void ReactorSurface::addSensitivityReaction(size_t i)
 {
     if (i >= m_kinetics->nReactions()) {
@@ -6,6 +6,8 @@
 #include "cantera/base/global.h"
 #include "cantera/base/utilities.h"
 
+#include <thread>
+
 using namespace Cantera;
 
 bool double_close(double expected, double actual, double tol)
@@ -292,9 +294,47 @@ TEST_F(PropertyPairs, ChemEquil_TV) { check_TV("element_potential"); }
 TEST_F(PropertyPairs, MultiPhase_TV) { check_TV("gibbs"); }
 TEST_F(PropertyPairs, VcsNonideal_TV) { check_TV("vcs"); }
 TEST_F(PropertyPairs, ChemEquil_UV) { check_UV("element_potential"); }
-// TEST_F(PropertyPairs, MultiPhase_UV) { check_UV("gibbs"); } // not implemented
+TEST_F(PropertyPairs, MultiPhase_UV) { check_UV("gibbs"); }
 TEST_F(PropertyPairs, VcsNonideal_UV) { check_UV("vcs"); }
 
+// Independent phase objects may be created and equilibrated concurrently.
+// This exercises the shared XML cache, the factories, and the equilibrium
+// solvers from multiple threads.
+class ThreadedEquil : public testing::Test
+{
+public:
+    static void solve(const std::string& solver, double T0, double* result) {
+        std::unique_ptr<ThermoPhase> gas(newPhase("gri30.xml", "gri30"));
+        gas->setState_TPX(T0, OneAtm, "CH4:1.0, O2:1.5, N2:5.64");
+        gas->equilibrate("HP", solver);
+        result[0] = gas->temperature();
+        result[1] = gas->moleFraction("CO2");
+    }
+
+    void check_HP(const std::string& solver) {
+        const size_t n = 4;
+        vector_fp serial(2*n), threaded(2*n);
+        for (size_t i = 0; i < n; i++) {
+            solve(solver, 300.0 + 50*i, &serial[2*i]);
+        }
+
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < n; i++) {
+            threads.emplace_back(solve, solver, 300.0 + 50*i, &threaded[2*i]);
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        for (size_t i = 0; i < 2*n; i++) {
+            EXPECT_DOUBLE_EQ(serial[i], threaded[i]);
+        }
+    }
+};
+
+TEST_F(ThreadedEquil, ChemEquil_HP) { check_HP("element_potential"); }
+TEST_F(ThreadedEquil, MultiPhase_HP) { check_HP("gibbs"); }
+TEST_F(ThreadedEquil, VcsNonideal_HP) { check_HP("vcs"); }
+
 int main(int argc, char** argv)
 {
     printf("Running main() from equil_gas.cpp\n");
@@ -0,0 +1,205 @@
+#include "gtest/gtest.h"
+
+#include "cantera/equil/EquilibriumTable.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/base/ctexceptions.h"
+#include "cantera/base/ctml.h"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace Cantera;
+
+class EquilibriumTableTest : public testing::Test
+{
+public:
+    EquilibriumTableTest() : gas(newPhase("h2o2.xml")), Y(gas->nSpecies()) {}
+
+    // Compare lookups at states between the tabulated points with direct
+    // equilibrium calculations
+    void check(EquilibriumTable& table, double P, double Ttol, double Ytol) {
+        for (size_t i = 0; i < 7; i++) {
+            double Z = 0.01 + 0.14 * i;
+            table.getUnreactedMassFractions(Z, &Y[0]);
+            for (size_t j = 0; j < 5; j++) {
+                double T0 = 320 + 210 * j;
+                gas->setState_TPY(T0, P, &Y[0]);
+                double h = gas->enthalpy_mass();
+                gas->equilibrate("HP");
+                double T = table.lookup(Z, h, P, &Y[0]);
+                EXPECT_NEAR(gas->temperature(), T, Ttol);
+                for (size_t k = 0; k < gas->nSpecies(); k++) {
+                    EXPECT_NEAR(gas->massFraction(k), Y[k], Ytol);
+                }
+                table.getUnreactedMassFractions(Z, &Y[0]);
+            }
+        }
+    }
+
+    // Enthalpy of the unreacted mixture at temperature T
+    double enthalpy(EquilibriumTable& table, double Z, double T) {
+        table.getUnreactedMassFractions(Z, &Y[0]);
+        gas->setState_TPY(T, OneAtm, &Y[0]);
+        return gas->enthalpy_mass();
+    }
+
+    std::unique_ptr<ThermoPhase> gas;
+    vector_fp Y;
+};
+
+TEST_F(EquilibriumTableTest, single_pressure)
+{
+    EquilibriumTable table(*gas, 2);
+    table.setStreams("H2:1.0", "O2:1.0, AR:3.76");
+    table.setTemperatureRange(300, 1500);
+    table.setTolerances(2.0, 2e-3);
+    table.setGrid(32, 2, 1, 5);
+    table.build();
+    EXPECT_TRUE(table.ready());
+    EXPECT_GT(table.nCells(), 8);
+
+    // Values at the tabulated points are exact
+    gas->setState_TPX(300, OneAtm, "O2:1.0, AR:3.76");
+    double h = gas->enthalpy_mass();
+    gas->equilibrate("HP");
+    EXPECT_NEAR(gas->temperature(), table.lookup(0.0, h, OneAtm), 1e-8);
+
+    // Interpolated values are close to the exact values
+    check(table, OneAtm, 4.0, 4e-3);
+
+    // The phase can be set to the interpolated state
+    std::unique_ptr<ThermoPhase> gas2(newPhase("h2o2.xml"));
+    h = enthalpy(table, 0.2, 900);
+    table.setState(*gas2, 0.2, h, OneAtm);
+    EXPECT_DOUBLE_EQ(table.lookup(0.2, h, OneAtm), gas2->temperature());
+    EXPECT_DOUBLE_EQ(OneAtm, gas2->pressure());
+
+    // States outside the table
+    EXPECT_THROW(table.lookup(1.2, h, OneAtm), CanteraError);
+    EXPECT_THROW(table.lookup(0.2, enthalpy(table, 0.2, 250), OneAtm),
+                 CanteraError);
+}
+
+TEST_F(EquilibriumTableTest, pressure_range)
+{
+    EquilibriumTable table(*gas, 2);
+    table.setStreams("H2:1.0", "O2:1.0, AR:3.76");
+    table.setPressureRange(1e5, 1e6);
+    table.setTolerances(5.0, 5e-3);
+    table.setGrid(32, 2, 1, 4);
+    table.build();
+    check(table, 1e5, 10.0, 1e-2);
+    check(table, 3e5, 10.0, 1e-2);
+    EXPECT_THROW(table.lookup(0.5, enthalpy(table, 0.5, 500), 2e6),
+                 CanteraError);
+}
+
+TEST_F(EquilibriumTableTest, finest_cells)
+{
+    // Without refinement, the error is not checked in any cell
+    EquilibriumTable table(*gas);
+    table.setStreams("H2:1.0", "O2:1.0, AR:3.76");
+    table.setGrid(4, 2, 1, 0);
+    table.build();
+    EXPECT_EQ(8, table.nCells());
+    EXPECT_EQ(8, table.nFinestCells());
+
+    // The tolerances are met without reaching the maximum level
+    table.setTolerances(1e4, 1.0);
+    table.setGrid(4, 2, 1, 3);
+    table.build();
+    EXPECT_EQ(8, table.nCells());
+    EXPECT_EQ(0, table.nFinestCells());
+
+    // The tolerances cannot be met
+    table.setTolerances(1e-3, 1e-6);
+    table.build();
+    EXPECT_GT(table.nFinestCells(), 0);
+    EXPECT_LE(table.nFinestCells(), table.nCells());
+}
+
+TEST_F(EquilibriumTableTest, save_and_load)
+{
+    EquilibriumTable table(*gas);
+    table.setStreams("H2:1.0", "O2:1.0, AR:3.76");
+    table.setGrid(4, 2, 1, 3);
+    table.build();
+    table.save("equil-table-test.xml");
+
+    EquilibriumTable table2(*gas);
+    EXPECT_FALSE(table2.ready());
+    table2.load("equil-table-test.xml");
+    std::remove("equil-table-test.xml");
+    EXPECT_EQ(table.nCells(), table2.nCells());
+    EXPECT_EQ(table.nFinestCells(), table2.nFinestCells());
+    EXPECT_EQ(table.nPoints(), table2.nPoints());
+
+    vector_fp Y2(gas->nSpecies());
+    for (size_t i = 0; i < 10; i++) {
+        double Z = 0.1 * i + 0.03;
+        double h = enthalpy(table, Z, 300 + 100 * i);
+        double T = table.lookup(Z, h, OneAtm, &Y[0]);
+        EXPECT_NEAR(T, table2.lookup(Z, h, OneAtm, &Y2[0]), 1e-10 * T);
+        for (size_t k = 0; k < gas->nSpecies(); k++) {
+            EXPECT_NEAR(Y[k], Y2[k], 1e-13);
+        }
+    }
+
+    // Species must match
+    std::unique_ptr<ThermoPhase> gri(newPhase("gri30.xml", "gri30"));
+    table.save("equil-table-test.xml");
+    EquilibriumTable table3(*gri);
+    EXPECT_THROW(table3.load("equil-table-test.xml"), CanteraError);
+    std::remove("equil-table-test.xml");
+}
+
+TEST_F(EquilibriumTableTest, load_invalid)
+{
+    EquilibriumTable table(*gas);
+    table.setStreams("H2:1.0", "O2:1.0, AR:3.76");
+    table.setGrid(4, 2, 1, 2);
+    table.build();
+    table.save("equil-table-test.xml");
+    XML_Node doc;
+    doc.build("equil-table-test.xml");
+    XML_Node* root = doc.findByName("equilibriumTable");
+    vector_fp cells;
+    getFloatArray(*getByTitle(*root, "cells"), cells, false);
+
+    // Write a copy of the table where entry *i* of the cell data is replaced
+    // by *value*, and check that it can't be loaded
+    EquilibriumTable table2(*gas);
+    auto check_invalid = [&](size_t i, double value) {
+        vector_fp v = cells;
+        v[i] = value;
+        XML_Node doc2;
+        doc.copy(&doc2);
+        XML_Node* root2 = doc2.findByName("equilibriumTable");
+        root2->removeChild(getByTitle(*root2, "cells"));
+        addFloatArray(*root2, "cells", v.size(), v.data());
+        std::ofstream out("equil-table-test.xml");
+        doc2.write(out);
+        out.close();
+        EXPECT_THROW(table2.load("equil-table-test.xml"), CanteraError)
+            << "i = " << i << ", value = " << value;
+    };
+
+    size_t nCells = cells.size() / 9;
+    check_invalid(0, static_cast<double>(nCells)); // child out of range
+    check_invalid(0, 0.0); // cell is its own child
+    check_invalid(9 * (nCells - 1), nCells - 2.0); // children would overlap end
+    check_invalid(1, -1.0); // corner index
+    check_invalid(4, static_cast<double>(table.nPoints()));
+    check_invalid(9 * (nCells - 1) + 2, 1e30);
+    EXPECT_FALSE(table2.ready());
+
+    // A failed load leaves a loaded table unchanged
+    table.save("equil-table-test.xml");
+    table2.load("equil-table-test.xml");
+    check_invalid(3, -5.0);
+    std::remove("equil-table-test.xml");
+    EXPECT_EQ(table.nCells(), table2.nCells());
+    double h = enthalpy(table, 0.3, 600);
+    EXPECT_DOUBLE_EQ(table.lookup(0.3, h, OneAtm),
+                     table2.lookup(0.3, h, OneAtm));
+}
@@ -0,0 +1,150 @@
+#include "gtest/gtest.h"
+#include "cantera/IdealGasMix.h"
+#include "cantera/transport.h"
+#include "cantera/zeroD/IdealGasReactor.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/oneD/Sim1D.h"
+#include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/Inlet1D.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+// Heap allocations are only counted on the thread which is being tested, while
+// an AllocationCounter exists.
+thread_local bool t_countAllocations = false;
+thread_local size_t t_nAllocations = 0;
+}
+
+void* operator new(size_t n)
+{
+    if (t_countAllocations) {
+        t_nAllocations++;
+    }
+    void* p = std::malloc(n ? n : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+namespace Cantera
+{
+
+//! Counts the heap allocations made by the current thread during its lifetime
+class AllocationCounter
+{
+public:
+    AllocationCounter() {
+        t_nAllocations = 0;
+        t_countAllocations = true;
+    }
+    ~AllocationCounter() {
+        t_countAllocations = false;
+    }
+    size_t count() const {
+        return t_nAllocations;
+    }
+};
+
+class AllocationTest : public testing::Test
+{
+public:
+    AllocationTest() : gas("h2o2.xml", "ohmech") {}
+    IdealGasMix gas;
+};
+
+TEST_F(AllocationTest, counter)
+{
+    vector_fp v;
+    AllocationCounter counter;
+    v.resize(10);
+    EXPECT_EQ((size_t) 1, counter.count());
+}
+
+TEST_F(AllocationTest, kinetics)
+{
+    vector_fp wdot(gas.nSpecies()), ropf(gas.nReactions());
+    gas.setState_TPX(1200, OneAtm, "H2:2, O2:1, AR:4");
+    gas.getNetProductionRates(wdot.data());
+
+    AllocationCounter counter;
+    for (size_t i = 0; i < 5; i++) {
+        gas.setState_TP(1200 + 50 * i, OneAtm * (1 + i));
+        gas.getNetProductionRates(wdot.data());
+        gas.getFwdRatesOfProgress(ropf.data());
+    }
+    EXPECT_EQ((size_t) 0, counter.count());
+}
+
+TEST_F(AllocationTest, set_composition)
+{
+    compositionMap X = parseCompString("H2:2, O2:1, AR:4");
+    gas.setMoleFractionsByName(X);
+    gas.setMassFractionsByName(X);
+
+    AllocationCounter counter;
+    gas.setMoleFractionsByName(X);
+    gas.setMassFractionsByName(X);
+    EXPECT_EQ((size_t) 0, counter.count());
+}
+
+TEST_F(AllocationTest, reactor_net)
+{
+    gas.setState_TPX(1200, OneAtm, "H2:2, O2:1, AR:4");
+    IdealGasReactor r;
+    r.insert(gas);
+    ReactorNet net;
+    net.addReactor(r);
+    net.step();
+
+    vector_fp y(net.neq()), ydot(net.neq());
+    net.getState(y.data());
+    AllocationCounter counter;
+    for (size_t i = 0; i < 5; i++) {
+        y[1] *= 1.001;
+        net.eval(net.time(), y.data(), ydot.data(), 0);
+    }
+    EXPECT_EQ((size_t) 0, counter.count());
+}
+
+TEST_F(AllocationTest, flame)
+{
+    gas.setState_TPX(300, OneAtm, "H2:2, O2:1, AR:4");
+    FreeFlame flow(&gas);
+    vector_fp z{0.0, 0.02, 0.04, 0.06, 0.08, 0.1};
+    flow.setupGrid(z.size(), z.data());
+    std::unique_ptr<Transport> tr(newTransportMgr("Mix", &gas));
+    flow.setTransport(*tr);
+    flow.setKinetics(gas);
+    flow.setPressure(OneAtm);
+
+    Inlet1D inlet;
+    inlet.setMoleFractions("H2:2, O2:1, AR:4");
+    inlet.setMdot(0.5 * gas.density());
+    inlet.setTemperature(300);
+    Outlet1D outlet;
+    std::vector<Domain1D*> domains{&inlet, &flow, &outlet};
+    Sim1D flame(domains);
+    vector_fp locs{0.0, 0.3, 0.7, 1.0};
+    vector_fp value{300, 300, 2000, 2000};
+    flame.setInitialGuess("T", locs, value);
+    flame.eval();
+    flame.eval(1e4);
+
+    AllocationCounter counter;
+    for (size_t i = 0; i < 5; i++) {
+        flame.eval();
+        flame.eval(1e4);
+    }
+    EXPECT_EQ((size_t) 0, counter.count());
+}
+
+}
@@ -0,0 +1,232 @@
+#include "gtest/gtest.h"
+#include "cantera/IdealGasMix.h"
+#include "cantera/zerodim.h"
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace Cantera
+{
+
+typedef std::vector<std::pair<size_t, size_t> > EdgeList;
+
+// Number of edges between reactors in different sub-networks
+size_t cutEdges(const EdgeList& edges, const std::vector<size_t>& part)
+{
+    size_t n = 0;
+    for (const auto& e : edges) {
+        n += (part[e.first] != part[e.second]);
+    }
+    return n;
+}
+
+TEST(PartitionReactorGraph, chain)
+{
+    EdgeList edges;
+    for (size_t i = 0; i < 7; i++) {
+        edges.push_back({i, i+1});
+    }
+    std::vector<size_t> part = partitionReactorGraph(vector_fp(8, 1.0), edges, 2);
+    EXPECT_EQ((size_t) 1, cutEdges(edges, part));
+    EXPECT_EQ((size_t) 4, std::count(part.begin(), part.end(), 0));
+
+    part = partitionReactorGraph(vector_fp(8, 1.0), edges, 4);
+    EXPECT_EQ((size_t) 3, cutEdges(edges, part));
+    for (size_t p = 0; p < 4; p++) {
+        EXPECT_EQ((size_t) 2, std::count(part.begin(), part.end(), p));
+    }
+}
+
+TEST(PartitionReactorGraph, clusters)
+{
+    // Two fully connected clusters of five reactors, connected by one edge.
+    // The reactors of the clusters are interleaved.
+    EdgeList edges;
+    for (size_t c = 0; c < 2; c++) {
+        for (size_t i = 0; i < 5; i++) {
+            for (size_t j = i + 1; j < 5; j++) {
+                edges.push_back({2*i + c, 2*j + c});
+            }
+        }
+    }
+    edges.push_back({4, 7});
+    std::vector<size_t> part = partitionReactorGraph(vector_fp(10, 1.0), edges, 2);
+    EXPECT_EQ((size_t) 1, cutEdges(edges, part));
+    for (size_t i = 0; i < 10; i += 2) {
+        EXPECT_EQ(part[0], part[i]);
+        EXPECT_EQ(part[1], part[i+1]);
+    }
+}
+
+TEST(PartitionReactorGraph, weights)
+{
+    // A chain where the first reactors have a larger mechanism than the rest
+    EdgeList edges;
+    vector_fp weights;
+    for (size_t i = 0; i < 12; i++) {
+        weights.push_back(i < 3 ? reactorCost(53, 325) : reactorCost(10, 27));
+        if (i) {
+            edges.push_back({i-1, i});
+        }
+    }
+    std::vector<size_t> part = partitionReactorGraph(weights, edges, 2);
+    // The most even split separates the first two reactors from the rest
+    EXPECT_EQ((size_t) 1, cutEdges(edges, part));
+    EXPECT_NE(part[1], part[2]);
+
+    EXPECT_THROW(partitionReactorGraph(weights, edges, 13), CanteraError);
+    edges.push_back({0, 12});
+    EXPECT_THROW(partitionReactorGraph(weights, edges, 2), CanteraError);
+}
+
+#ifndef _WIN32
+
+// A chain of four non-reacting reactors, fed with hot gas from a reservoir,
+// with a wall between the second and the third reactor. Either the complete
+// chain, or one of the sub-networks containing reactors 0-1 or 2-3, in which
+// the adjacent reactor of the other sub-network is replaced by a ghost.
+class ReactorChain
+{
+public:
+    explicit ReactorChain(int part = -1) {
+        inlet.insert(phase("O2:1, AR:4", 1000));
+        outlet.insert(phase("AR:1", 300));
+        std::vector<ReactorBase*> nodes{&inlet};
+        for (size_t i = 0; i < 4; i++) {
+            if (part == -1 || int(i / 2) == part) {
+                r[i].insert(phase("AR:1", 300));
+                r[i].setInitialVolume(0.1);
+                r[i].setChemistry(false);
+                net.addReactor(r[i]);
+                nodes.push_back(&r[i]);
+                local.push_back(true);
+            } else {
+                ghost[i].insert(phase("AR:1", 300));
+                nodes.push_back(&ghost[i]);
+                local.push_back(false);
+            }
+        }
+        nodes.push_back(&outlet);
+        for (size_t i = 0; i < 5; i++) {
+            if ((i > 0 && local[i-1]) || (i < 4 && local[i])) {
+                mfc[i].install(*nodes[i], *nodes[i+1]);
+                mfc[i].setMassFlowRate(0.2);
+            }
+        }
+        if (local[1] || local[2]) {
+            wall.install(*nodes[2], *nodes[3]);
+            wall.setArea(1.0);
+            wall.setHeatTransferCoeff(100.0);
+        }
+    }
+
+    IdealGasMix& phase(const std::string& X, double T) {
+        gas.emplace_back(new IdealGasMix("h2o2.xml", "ohmech"));
+        gas.back()->setState_TPX(T, OneAtm, X);
+        return *gas.back();
+    }
+
+    std::vector<std::unique_ptr<IdealGasMix> > gas;
+    Reservoir inlet, outlet;
+    IdealGasReactor r[4];
+    Reservoir ghost[4];
+    std::vector<bool> local;
+    MassFlowController mfc[5];
+    Wall wall;
+    ReactorNet net;
+};
+
+// Integrate the sub-network *part* of the chain, coupled to the other
+// sub-network through *channel*. Returns the temperatures of its reactors,
+// the final time and the coupling residual.
+vector_fp runPartition(int part, CouplingChannel& channel, bool gaussSeidel)
+{
+    ReactorChain chain(part);
+    CoupledReactorNet coupled(chain.net, part);
+    size_t peer = coupled.addPeer(channel, 1 - part);
+    if (part == 0) {
+        coupled.addExport(chain.r[1], peer, 1);
+        coupled.addImport(chain.ghost[2], peer, 2);
+    } else {
+        coupled.addExport(chain.r[2], peer, 2);
+        coupled.addImport(chain.ghost[1], peer, 1);
+    }
+    coupled.setCouplingInterval(0.002);
+    coupled.setCouplingIterations(2);
+    coupled.setGaussSeidel(gaussSeidel);
+    coupled.advance(1.0);
+    coupled.advance(2.0);
+    return {chain.r[2*part].temperature(), chain.r[2*part + 1].temperature(),
+            coupled.time(), coupled.couplingResidual()};
+}
+
+// Integrate the two sub-networks in separate processes and compare with the
+// integration of the complete chain
+void checkTwoProcesses(bool gaussSeidel)
+{
+    ReactorChain ref;
+    ref.net.advance(2.0);
+
+    int fds[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        // The second sub-network, which sends its results to the parent
+        ::close(fds[0]);
+        int status = 0;
+        try {
+            SocketChannel channel(fds[1]);
+            vector_fp T = runPartition(1, channel, gaussSeidel);
+            channel.send(T.data(), T.size());
+        } catch (...) {
+            status = 1;
+        }
+        _exit(status);
+    }
+    ::close(fds[1]);
+    vector_fp T0, T1;
+    std::exception_ptr error;
+    try {
+        SocketChannel channel(fds[0]);
+        T0 = runPartition(0, channel, gaussSeidel);
+        channel.receive(T1);
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    // Collect the child process before checking any of the results
+    int status;
+    waitpid(pid, &status, 0);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(0, WEXITSTATUS(status));
+    ASSERT_EQ((size_t) 4, T1.size());
+    EXPECT_NEAR(2.0, T0[2], 1e-12);
+    EXPECT_LT(T0[3], 1e-3);
+
+    vector_fp T = {T0[0], T0[1], T1[0], T1[1]};
+    for (size_t i = 0; i < 4; i++) {
+        EXPECT_GT(ref.r[i].temperature(), 400);
+        EXPECT_NEAR(ref.r[i].temperature(), T[i], 1.0) << i;
+    }
+}
+
+TEST(CoupledReactorNet, jacobi)
+{
+    checkTwoProcesses(false);
+}
+
+TEST(CoupledReactorNet, gauss_seidel)
+{
+    checkTwoProcesses(true);
+}
+
+#endif
+
+}
@@ -0,0 +1,111 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/kinetics/EdgeKinetics.h"
+#include "cantera/kinetics/importKinetics.h"
+#include "cantera/zeroD/ElectrodeReactor.h"
+#include "cantera/zeroD/ReactorSurface.h"
+#include "cantera/zeroD/ReactorNet.h"
+
+namespace Cantera
+{
+
+// A metal electrode with charge transfer reactions at the three-phase
+// boundary with an oxide electrolyte
+class ElectrodeReactorTest : public testing::Test
+{
+public:
+    ElectrodeReactorTest()
+        : metal(newPhase("../data/sofc-test.xml", "metal"))
+        , msurf(newPhase("../data/sofc-test.xml", "metal_surface"))
+        , osurf(newPhase("../data/sofc-test.xml", "oxide_surface"))
+        , tpb(newPhase("../data/sofc-test.xml", "tpb"))
+    {
+        std::vector<ThermoPhase*> phases{metal.get(), msurf.get(),
+                                         osurf.get(), tpb.get()};
+        importKinetics(tpb->xml(), phases, &kin);
+        msurf->setMoleFractionsByName("(m):0.3 H(m):0.3 O(m):0.4");
+        osurf->setMoleFractionsByName("(ox):0.2 O''(ox):0.5 OH'(ox):0.3");
+        metal->setElectricPotential(0.2);
+        osurf->setElectricPotential(-0.1);
+
+        surf.setKinetics(&kin);
+        surf.setArea(2e-3);
+        r.setThermoMgr(*metal);
+        r.addSurface(&surf);
+        r.setDoubleLayerCapacitance(0.5);
+        net.addReactor(r);
+        net.reinitialize();
+        y.resize(net.neq());
+        ydot.resize(net.neq());
+        net.getState(y.data());
+    }
+
+    // Rate of change of the electrode potential at potential *phi*
+    double dphidt(double phi) {
+        y[0] = phi;
+        net.eval(0.0, y.data(), ydot.data(), 0);
+        return ydot[0];
+    }
+
+    std::unique_ptr<ThermoPhase> metal, msurf, osurf, tpb;
+    EdgeKinetics kin;
+    ReactorSurface surf;
+    ElectrodeReactor r;
+    ReactorNet net;
+    vector_fp y, ydot;
+};
+
+TEST_F(ElectrodeReactorTest, charging)
+{
+    ASSERT_EQ((size_t) 0, r.componentIndex("potential"));
+    EXPECT_DOUBLE_EQ(0.2, y[0]);
+    double CA = r.doubleLayerCapacitance() * r.surfaceArea();
+
+    // Without an external current, the double layer is charged by the
+    // faradaic current only
+    double rate0 = dphidt(0.2);
+    double IF = r.faradaicCurrent();
+    ASSERT_NE(0.0, IF);
+    EXPECT_NEAR(-IF / CA, rate0, 1e-12 * std::abs(rate0));
+
+    // A constant applied current changes the rate by I / (C * A)
+    double I = 3.0 * std::abs(IF);
+    r.setCurrent(I);
+    EXPECT_NEAR(rate0 + I / CA, dphidt(0.2), 1e-12 * I / CA);
+}
+
+TEST_F(ElectrodeReactorTest, faradaic_current_derivative)
+{
+    double dphi = 1e-6;
+    dphidt(0.2 + dphi);
+    double Ip = r.faradaicCurrent();
+    dphidt(0.2 - dphi);
+    double Im = r.faradaicCurrent();
+    dphidt(0.2);
+    double dIdphi = r.faradaicCurrent_ddPhi();
+    EXPECT_NEAR((Ip - Im) / (2 * dphi), dIdphi, 1e-6 * std::abs(dIdphi));
+}
+
+TEST_F(ElectrodeReactorTest, steady_state)
+{
+    // Find the potential at which the applied current is balanced by the
+    // faradaic current
+    dphidt(0.2);
+    double I = r.faradaicCurrent() + 1e-3 * r.surfaceArea();
+    r.setCurrent(I);
+    double phi = 0.2;
+    for (int i = 0; i < 50; i++) {
+        dphidt(phi);
+        double dphi = (I - r.faradaicCurrent()) / r.faradaicCurrent_ddPhi();
+        phi += dphi;
+        if (std::abs(dphi) < 1e-12) {
+            break;
+        }
+    }
+    EXPECT_NEAR(0.0, dphidt(phi), 1e-8);
+    EXPECT_NEAR(I, r.faradaicCurrent(), 1e-10 * std::abs(I));
+    EXPECT_DOUBLE_EQ(phi, r.electricPotential());
+    EXPECT_NE(0.2, phi);
+}
+
+}
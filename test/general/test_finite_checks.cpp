@@ -0,0 +1,77 @@
+#include "gtest/gtest.h"
+#include "cantera/base/utilities.h"
+#include "cantera/base/ctexceptions.h"
+
+#include <limits>
+
+namespace Cantera
+{
+
+class FiniteChecks : public testing::Test
+{
+public:
+    FiniteChecks() : values(4, 1.0) {
+        resetNonFiniteCount();
+    }
+    ~FiniteChecks() {
+        setFiniteCheckInterval(1);
+        setFiniteCheckThrows(true);
+        resetNonFiniteCount();
+    }
+
+    // All calls share a single check location, whose sample counter is kept
+    // between tests. The tests only make checks where the number of checks
+    // performed doesn't depend on the starting value of the counter.
+    void check() {
+        CheckFiniteSampled("values", values.data(), values.size());
+    }
+
+    vector_fp values;
+};
+
+TEST_F(FiniteChecks, throws)
+{
+    check();
+    values[2] = std::numeric_limits<double>::quiet_NaN();
+#ifdef CT_NO_FINITE_CHECKS
+    check();
+    EXPECT_EQ((size_t) 0, nonFiniteCount());
+#else
+    EXPECT_THROW(check(), CanteraError);
+    EXPECT_EQ((size_t) 1, nonFiniteCount());
+#endif
+}
+
+#ifndef CT_NO_FINITE_CHECKS
+TEST_F(FiniteChecks, counted)
+{
+    setFiniteCheckThrows(false);
+    values[0] = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < 10; i++) {
+        check();
+    }
+    EXPECT_EQ((size_t) 10, nonFiniteCount());
+    resetNonFiniteCount();
+    EXPECT_EQ((size_t) 0, nonFiniteCount());
+}
+
+TEST_F(FiniteChecks, sampled)
+{
+    setFiniteCheckThrows(false);
+    values[0] = std::numeric_limits<double>::infinity();
+    setFiniteCheckInterval(4);
+    EXPECT_EQ((size_t) 4, finiteCheckInterval());
+    for (size_t i = 0; i < 20; i++) {
+        check();
+    }
+    EXPECT_EQ((size_t) 5, nonFiniteCount());
+
+    setFiniteCheckInterval(0);
+    for (size_t i = 0; i < 20; i++) {
+        check();
+    }
+    EXPECT_EQ((size_t) 5, nonFiniteCount());
+}
+#endif
+
+}
@@ -0,0 +1,87 @@
+#include "gtest/gtest.h"
+#include "cantera/base/global.h"
+#include "cantera/base/logger.h"
+
+#include <thread>
+
+namespace Cantera
+{
+
+class CaptureLogger : public Logger
+{
+public:
+    CaptureLogger(std::string& text) : m_text(text) {}
+    virtual void write(const std::string& msg) {
+        m_text += msg;
+    }
+    virtual void writeendl() {
+        m_text += "\n";
+    }
+    std::string& m_text;
+};
+
+class LoggingTest : public testing::Test
+{
+public:
+    ~LoggingTest() {
+        setLogger(new Logger());
+    }
+};
+
+TEST_F(LoggingTest, debuglog)
+{
+    std::string text;
+    setLogger(new CaptureLogger(text));
+    debuglog("foo", 0);
+    debuglog(std::string("bar"), 0);
+    debuglog(0, "{} {}", "baz", 1);
+    EXPECT_EQ("", text);
+    debuglog("foo ", 1);
+    debuglog(std::string("bar "), 2);
+    debuglog(1, "{}-{:.2f}", "baz", 1.25);
+    writelogendl();
+    EXPECT_EQ("foo bar baz-1.25\n", text);
+}
+
+TEST_F(LoggingTest, per_thread_loggers)
+{
+    std::string mainText;
+    setLogger(new CaptureLogger(mainText));
+    std::vector<std::string> texts(4);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < texts.size(); i++) {
+        threads.emplace_back([i, &texts]() {
+            setLogger(new CaptureLogger(texts[i]));
+            for (size_t n = 0; n < 100; n++) {
+                writelog("{}", i);
+            }
+            thread_complete();
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (size_t i = 0; i < texts.size(); i++) {
+        EXPECT_EQ(std::string(100, '0' + i), texts[i]);
+    }
+    writelog("main");
+    EXPECT_EQ("main", mainText);
+}
+
+TEST_F(LoggingTest, application_destroyed)
+{
+    std::string text1, text2;
+    setLogger(new CaptureLogger(text1));
+    writelog("a");
+    appdelete();
+    // Restore the setting made in main() for the tests which follow
+    make_deprecation_warnings_fatal();
+    // The messages of the new application are distinct from those cached
+    // for the old one
+    setLogger(new CaptureLogger(text2));
+    writelog("b");
+    EXPECT_EQ("a", text1);
+    EXPECT_EQ("b", text2);
+}
+
+}
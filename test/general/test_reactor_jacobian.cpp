@@ -0,0 +1,119 @@
+#include "gtest/gtest.h"
+#include "cantera/IdealGasMix.h"
+#include "cantera/zeroD/IdealGasReactor.h"
+#include "cantera/zeroD/Reservoir.h"
+#include "cantera/zeroD/Wall.h"
+#include "cantera/zeroD/ReactorNet.h"
+
+namespace Cantera
+{
+
+// A reactor coupled to a reservoir through a wall, so that the Jacobian
+// includes terms which depend on the state of more than one object
+class ReactorNetwork
+{
+public:
+    ReactorNetwork() : gas("h2o2.xml", "ohmech"), env("h2o2.xml", "ohmech") {
+        gas.setState_TPX(1200, OneAtm, "H2:2, O2:1, AR:4");
+        env.setState_TPX(300, OneAtm, "AR:1");
+        r.insert(gas);
+        res.insert(env);
+        w.install(r, res);
+        w.setHeatTransferCoeff(100.0);
+        w.setExpansionRateCoeff(1e-4);
+        net.addReactor(r);
+    }
+
+    IdealGasMix gas, env;
+    IdealGasReactor r;
+    Reservoir res;
+    Wall w;
+    ReactorNet net;
+};
+
+TEST(ReactorNet, ParallelJacobian)
+{
+    ReactorNetwork n1, n2, n3;
+    n1.net.step();
+    size_t nv = n1.net.neq();
+    vector_fp y(nv), ydot1(nv), ydot2(nv);
+    n1.net.getState(y.data());
+    Array2D J1(nv, nv), J2(nv, nv);
+    n1.net.evalJacobian(n1.net.time(), y.data(), ydot1.data(), 0, &J1);
+
+    n1.net.addJacobianWorker(n2.net);
+    n1.net.addJacobianWorker(n3.net);
+    n1.net.evalJacobian(n1.net.time(), y.data(), ydot2.data(), 0, &J2);
+    for (size_t i = 0; i < nv; i++) {
+        EXPECT_EQ(ydot1[i], ydot2[i]);
+        for (size_t j = 0; j < nv; j++) {
+            EXPECT_EQ(J1(i, j), J2(i, j)) << "i = " << i << ", j = " << j;
+        }
+    }
+
+    EXPECT_THROW(n1.net.addJacobianWorker(n1.net), CanteraError);
+}
+
+TEST(ReactorNet, ParallelJacobianMismatch)
+{
+    ReactorNetwork n1, n2;
+    n1.net.step();
+    size_t nv = n1.net.neq();
+    vector_fp y(nv), ydot(nv);
+    n1.net.getState(y.data());
+    Array2D J(nv, nv);
+    n1.net.addJacobianWorker(n2.net);
+    n1.net.evalJacobian(n1.net.time(), y.data(), ydot.data(), 0, &J);
+
+    // Reservoir in a different state
+    n2.env.setState_TP(310, OneAtm);
+    n2.res.syncState();
+    EXPECT_THROW(n1.net.evalJacobian(n1.net.time(), y.data(), ydot.data(), 0,
+                                     &J), CanteraError);
+    n2.env.setState_TP(300, OneAtm);
+    n2.res.syncState();
+    n1.net.evalJacobian(n1.net.time(), y.data(), ydot.data(), 0, &J);
+
+    // Modified wall
+    n2.w.setHeatTransferCoeff(200.0);
+    EXPECT_THROW(n1.net.evalJacobian(n1.net.time(), y.data(), ydot.data(), 0,
+                                     &J), CanteraError);
+
+    // Different sensitivity parameters
+    ReactorNetwork n3, n4;
+    n3.r.addSensitivityReaction(2);
+    n3.net.step();
+    n3.net.getState(y.data());
+    n3.net.addJacobianWorker(n4.net);
+    EXPECT_THROW(n3.net.evalJacobian(n3.net.time(), y.data(), ydot.data(),
+                                     n3.net.m_sens_params.data(), &J),
+                 CanteraError);
+}
+
+TEST(ReactorNet, ParallelJacobianExact)
+{
+    // Without reactions, at a state which differs from the last state
+    // evaluated by the networks, the Jacobian is identical to the one
+    // evaluated serially
+    ReactorNetwork n1, n2, n3;
+    n1.r.setChemistry(false);
+    n2.r.setChemistry(false);
+    n3.r.setChemistry(false);
+    n1.net.step();
+    size_t nv = n1.net.neq();
+    vector_fp y(nv), ydot(nv);
+    n1.net.getState(y.data());
+    y[2] += 10.0;
+    Array2D J1(nv, nv), J2(nv, nv);
+    n1.net.evalJacobian(n1.net.time(), y.data(), ydot.data(), 0, &J1);
+    n1.net.addJacobianWorker(n2.net);
+    n1.net.addJacobianWorker(n3.net);
+    n1.net.evalJacobian(n1.net.time(), y.data(), ydot.data(), 0, &J2);
+    for (size_t i = 0; i < nv; i++) {
+        for (size_t j = 0; j < nv; j++) {
+            EXPECT_EQ(J1(i, j), J2(i, j)) << "i = " << i << ", j = " << j;
+        }
+    }
+}
+
+}
@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include "cantera/base/WorkerThreads.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+TEST(WorkerThreads, reuse)
+{
+    WorkerThreads threads(4);
+    EXPECT_EQ(threads.nThreads(), (size_t) 4);
+    std::vector<std::thread::id> ids(4);
+    std::vector<int> count(4, 0);
+    for (size_t n : {4, 2, 4, 1, 0, 3}) {
+        threads.run(n, [&](size_t i) {
+            if (ids[i] == std::thread::id()) {
+                ids[i] = std::this_thread::get_id();
+            }
+            EXPECT_EQ(ids[i], std::this_thread::get_id());
+            count[i]++;
+        });
+    }
+    EXPECT_EQ(ids[0], std::this_thread::get_id());
+    EXPECT_NE(ids[1], ids[0]);
+    EXPECT_NE(ids[3], ids[2]);
+    EXPECT_EQ(count[0], 5);
+    EXPECT_EQ(count[1], 4);
+    EXPECT_EQ(count[2], 3);
+    EXPECT_EQ(count[3], 2);
+}
+
+TEST(WorkerThreads, exceptions)
+{
+    WorkerThreads threads(3);
+    std::vector<int> done(3, 0);
+    EXPECT_THROW(threads.run(3, [&](size_t i) {
+        if (i == 2) {
+            throw CanteraError("test", "task failed");
+        }
+        done[i] = 1;
+    }), CanteraError);
+    EXPECT_EQ(done[0], 1);
+    EXPECT_EQ(done[1], 1);
+
+    // The threads are still usable after an exception
+    threads.run(3, [&](size_t i) { done[i] = 2; });
+    EXPECT_EQ(done[2], 2);
+    EXPECT_THROW(threads.run(4, [](size_t i) {}), CanteraError);
+}
+
+}
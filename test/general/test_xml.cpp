@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include "cantera/base/xml.h"
+#include "cantera/base/ctml.h"
 #include <fstream>
 
 namespace Cantera
@@ -26,4 +27,81 @@ TEST(XML_Node, read_write)
     }
 }
 
+TEST(XML_Node, build_from_string)
+{
+    std::stringstream in(
+        "<?xml version=\"1.0\"?>\n"
+        "<ctml>\n"
+        "  <!-- a comment -->\n"
+        "  <empty a='1' b=\"two\"/>\n"
+        "  <text>  first line\n"
+        "        second line  </text>\n"
+        "  <floatArray size=\"4\" units=\"cm\">\n"
+        "    1.0, -2.5e1,\n"
+        "    3.0D2,  4,\n"
+        "  </floatArray>\n"
+        "</ctml>\n");
+    XML_Node root;
+    root.build(in);
+    ASSERT_EQ("ctml", root.name());
+    ASSERT_EQ((size_t) 4, root.nChildren());
+    EXPECT_TRUE(root.child(0).isComment());
+    EXPECT_EQ(" a comment ", root.child(0).value());
+
+    XML_Node& empty = root.child("empty");
+    EXPECT_EQ("1", empty["a"]);
+    EXPECT_EQ("two", empty["b"]);
+    EXPECT_EQ("", empty.value());
+    EXPECT_EQ(3, empty.lineNumber());
+
+    XML_Node& text = root.child("text");
+    EXPECT_EQ("first line\n second line", text.value());
+    EXPECT_EQ(4, text.lineNumber());
+
+    vector_fp v;
+    getFloatArray(root, v, true, "length", "floatArray");
+    ASSERT_EQ((size_t) 4, v.size());
+    EXPECT_DOUBLE_EQ(0.01, v[0]);
+    EXPECT_DOUBLE_EQ(-0.25, v[1]);
+    EXPECT_DOUBLE_EQ(3.0, v[2]);
+    EXPECT_DOUBLE_EQ(0.04, v[3]);
+}
+
+TEST(XML_Node, find)
+{
+    XML_Node root("ctml");
+    XML_Node& a = root.addChild("a");
+    XML_Node& b = a.addChild("phase");
+    b.addAttribute("id", "gas");
+    XML_Node& c = root.addChild("phase");
+    c.addAttribute("id", "gas");
+    c.addAttribute("name", "c");
+
+    // findNameID checks the children before searching the subtrees
+    EXPECT_EQ(&c, root.findNameID("phase", "gas"));
+    EXPECT_EQ(&c, findXMLPhase(&root, ""));
+    EXPECT_EQ(&b, a.findNameID("phase", ""));
+    EXPECT_EQ(&b, root.findID("gas"));
+    EXPECT_EQ(&c, root.findID("gas", 1));
+    EXPECT_EQ(&c, root.findByAttr("name", "c"));
+    EXPECT_EQ(&b, root.findByName("phase"));
+    EXPECT_EQ(nullptr, a.findByAttr("name", "c"));
+    EXPECT_EQ(nullptr, root.findByName("phase", 0));
+
+    // Changes to the tree are reflected in subsequent searches
+    b.addAttribute("id", "solid");
+    XML_Node& d = a.addChild("phase");
+    d.addAttribute("id", "gas");
+    EXPECT_EQ(&d, root.findID("gas"));
+    EXPECT_EQ(&b, findXMLPhase(&root, "solid"));
+    a.setName("phase");
+    EXPECT_EQ(&a, root.findNameID("phase", ""));
+
+    root.removeChild(&a);
+    EXPECT_EQ(&c, root.findID("gas"));
+    EXPECT_EQ(&d, a.findID("gas"));
+    EXPECT_EQ(nullptr, root.findByAttr("id", "solid"));
+    delete &a;
+}
+
 }
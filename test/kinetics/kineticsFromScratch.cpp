@@ -4,6 +4,7 @@
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/kinetics/GasKinetics.h"
 #include "cantera/kinetics/InterfaceKinetics.h"
+#include "cantera/kinetics/FalloffFactory.h"
 #include "cantera/base/Array.h"
 
 using namespace Cantera;
@@ -304,6 +305,274 @@ TEST_F(KineticsFromScratch, invalid_nonreactant_order)
     ASSERT_EQ((size_t) 0, kin.nReactions());
 }
 
+TEST_F(KineticsFromScratch, bulk_edit)
+{
+    std::string X = "O:0.02 H2:0.2 O2:0.5 H:0.03 OH:0.05 H2O:0.1 HO2:0.01";
+    p.setState_TPX(1200, 5*OneAtm, X);
+    p_ref.setState_TPX(1200, 5*OneAtm, X);
+    size_t nr = kin_ref.nReactions();
+    vector_fp kf(nr), kr(nr), kf_ref(nr), kr_ref(nr);
+    kin_ref.getFwdRateConstants(kf_ref.data());
+    kin_ref.getRevRateConstants(kr_ref.data());
+
+    kin.addReaction(kin_ref.reaction(0));
+    kin.setMultiplier(0, 2.0);
+    kin.beginEdit();
+    EXPECT_TRUE(kin.editing());
+    for (size_t i = 1; i < nr; i++) {
+        kin.addReaction(kin_ref.reaction(i));
+    }
+    // Modifying a pending reaction
+    kin.modifyReaction(1, kin_ref.reaction(1));
+    kin.setMultiplier(nr - 1, 3.0);
+    EXPECT_THROW(kin.beginEdit(), CanteraError);
+    kin.commitEdit();
+    EXPECT_FALSE(kin.editing());
+    EXPECT_THROW(kin.commitEdit(), CanteraError);
+
+    ASSERT_EQ(nr, kin.nReactions());
+    kin.getFwdRateConstants(kf.data());
+    kin.getRevRateConstants(kr.data());
+    EXPECT_DOUBLE_EQ(2.0, kin.multiplier(0));
+    EXPECT_DOUBLE_EQ(3.0, kin.multiplier(nr - 1));
+    for (size_t i = 0; i < nr; i++) {
+        double f = kin.multiplier(i);
+        EXPECT_DOUBLE_EQ(f * kf_ref[i], kf[i]) << "i = " << i;
+        EXPECT_DOUBLE_EQ(f * kr_ref[i], kr[i]) << "i = " << i;
+    }
+
+    // Remove the first and last reactions, which requires all of the others
+    // to be rebuilt
+    kin.beginEdit();
+    kin.removeReaction(nr - 1);
+    kin.removeReaction(0);
+    kin.commitEdit();
+    ASSERT_EQ(nr - 2, kin.nReactions());
+    vector_fp rop(nr), rop_ref(nr);
+    kin_ref.setMultiplier(0, 0.0);
+    kin_ref.setMultiplier(nr - 1, 0.0);
+    kin.getFwdRateConstants(kf.data());
+    kin.getNetRatesOfProgress(rop.data());
+    kin_ref.getNetRatesOfProgress(rop_ref.data());
+    for (size_t i = 0; i < nr - 2; i++) {
+        EXPECT_DOUBLE_EQ(kf_ref[i+1], kf[i]) << "i = " << i;
+        EXPECT_DOUBLE_EQ(rop_ref[i+1], rop[i]) << "i = " << i;
+        EXPECT_DOUBLE_EQ(1.0, kin.multiplier(i));
+    }
+
+    // Species production rates are consistent with the remaining reactions
+    vector_fp wdot(p.nSpecies()), wdot_ref(p.nSpecies());
+    kin.getNetProductionRates(wdot.data());
+    kin_ref.getNetProductionRates(wdot_ref.data());
+    for (size_t k = 0; k < p.nSpecies(); k++) {
+        EXPECT_NEAR(wdot_ref[k], wdot[k], 1e-12 * std::abs(wdot_ref[k]) + 1e-30);
+    }
+}
+
+TEST_F(KineticsFromScratch, bulk_edit_invalid_reaction)
+{
+    std::string X = "O:0.02 H2:0.2 O2:0.5 H:0.03 OH:0.05 H2O:0.1 HO2:0.01";
+    p.setState_TPX(1200, 5*OneAtm, X);
+    p_ref.setState_TPX(1200, 5*OneAtm, X);
+    kin.addReaction(kin_ref.reaction(0));
+    kin.addReaction(kin_ref.reaction(1));
+    kin.setMultiplier(1, 2.0);
+
+    // third body efficiency for an undefined species
+    Composition reac = parseCompString("O:2");
+    Composition prod = parseCompString("O2:1");
+    ThirdBody tbody;
+    tbody.efficiencies = parseCompString("H2:0.1 CO2:0.83");
+    auto R = make_shared<ThreeBodyReaction>(reac, prod,
+                                            Arrhenius(1.2e11, -1.0, 0.0),
+                                            tbody);
+
+    kin.beginEdit();
+    kin.addReaction(kin_ref.reaction(2));
+    kin.addReaction(R);
+    ASSERT_EQ((size_t) 4, kin.nReactions());
+
+    // Rates can't be evaluated until the edit is committed
+    vector_fp kf(4), wdot(p.nSpecies());
+    EXPECT_THROW(kin.getFwdRateConstants(kf.data()), CanteraError);
+    EXPECT_THROW(kin.getEquilibriumConstants(kf.data()), CanteraError);
+    EXPECT_THROW(kin.getNetProductionRates(wdot.data()), CanteraError);
+    EXPECT_THROW(kin.updateRatesOfProgress(), CanteraError);
+
+    // The failed commit leaves the mechanism and the edit unchanged
+    EXPECT_THROW(kin.commitEdit(), CanteraError);
+    EXPECT_TRUE(kin.editing());
+    ASSERT_EQ((size_t) 4, kin.nReactions());
+    EXPECT_EQ(R, kin.reaction(3));
+    EXPECT_DOUBLE_EQ(2.0, kin.multiplier(1));
+    EXPECT_THROW(kin.getFwdRateConstants(kf.data()), CanteraError);
+
+    kin.removeReaction(3);
+    kin.commitEdit();
+    ASSERT_EQ((size_t) 3, kin.nReactions());
+    vector_fp kf_ref(kin_ref.nReactions());
+    kin.getFwdRateConstants(kf.data());
+    kin_ref.getFwdRateConstants(kf_ref.data());
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_DOUBLE_EQ(kin.multiplier(i) * kf_ref[i], kf[i]) << i;
+    }
+}
+
+TEST_F(KineticsFromScratch, bulk_edit_invalid_reaction_replaced)
+{
+    std::string X = "O:0.02 H2:0.2 O2:0.5 H:0.03 OH:0.05 H2O:0.1 HO2:0.01";
+    p.setState_TPX(1200, 5*OneAtm, X);
+    p_ref.setState_TPX(1200, 5*OneAtm, X);
+    kin.addReaction(kin_ref.reaction(0));
+    kin.addReaction(kin_ref.reaction(1));
+    kin.setMultiplier(1, 2.0);
+
+    Composition reac = parseCompString("O:2");
+    Composition prod = parseCompString("O2:1");
+    ThirdBody tbody;
+    tbody.efficiencies = parseCompString("H2:0.1 CO2:0.83");
+    auto R = make_shared<ThreeBodyReaction>(reac, prod,
+                                            Arrhenius(1.2e11, -1.0, 0.0),
+                                            tbody);
+
+    kin.beginEdit();
+    kin.addReaction(kin_ref.reaction(2));
+    kin.addReaction(R);
+    EXPECT_THROW(kin.commitEdit(), CanteraError);
+
+    // Replace the invalid reaction. The data for the reactions which existed
+    // before the edit is reused by the next commit.
+    tbody.efficiencies = parseCompString("H2:0.1");
+    auto R2 = make_shared<ThreeBodyReaction>(reac, prod,
+                                             Arrhenius(1.2e11, -1.0, 0.0),
+                                             tbody);
+    kin.modifyReaction(3, R2);
+    kin.commitEdit();
+    EXPECT_FALSE(kin.editing());
+    ASSERT_EQ((size_t) 4, kin.nReactions());
+    EXPECT_DOUBLE_EQ(2.0, kin.multiplier(1));
+
+    vector_fp kf(4), kf_ref(kin_ref.nReactions());
+    kin.getFwdRateConstants(kf.data());
+    kin_ref.getFwdRateConstants(kf_ref.data());
+    for (size_t i = 0; i < 3; i++) {
+        EXPECT_DOUBLE_EQ(kin.multiplier(i) * kf_ref[i], kf[i]) << i;
+    }
+    EXPECT_GT(kf[3], 0.0);
+}
+
+TEST_F(KineticsFromScratch, remove_reaction)
+{
+    kin.addReaction(kin_ref.reaction(0));
+    kin.addReaction(kin_ref.reaction(1));
+    kin.removeReaction(0);
+    EXPECT_FALSE(kin.editing());
+    check_rates(1);
+    EXPECT_THROW(kin.removeReaction(1), CanteraError);
+}
+
+TEST_F(KineticsFromScratch, set_rate_parameters)
+{
+    size_t nr = kin_ref.nReactions();
+    for (size_t i = 0; i < nr; i++) {
+        kin.addReaction(kin_ref.reaction(i));
+    }
+    std::string X = "O:0.02 H2:0.2 O2:0.5 H:0.03 OH:0.05 H2O:0.1 HO2:0.01";
+    p.setState_TPX(1200, 5*OneAtm, X);
+    p_ref.setState_TPX(1200, 5*OneAtm, X);
+    vector_fp kf(nr), kf_ref(nr), kf0(nr);
+    kin_ref.getFwdRateConstants(kf0.data());
+
+    vector_fp A(nr), b(nr), E(nr);
+    kin.getArrheniusParameters(A.data(), b.data(), E.data());
+    EXPECT_DOUBLE_EQ(3.87e1, A[0]);
+    EXPECT_DOUBLE_EQ(-0.37, b[2]); // high pressure limit
+    EXPECT_TRUE(std::isnan(A[3])); // P-log
+    EXPECT_TRUE(std::isnan(E[4])); // Chebyshev
+    for (size_t i = 0; i < nr; i++) {
+        A[i] *= 2.0;
+        b[i] += 0.1;
+        E[i] += 100.0;
+    }
+    kin.setArrheniusParameters(A.data(), b.data(), E.data());
+    kin.setLowPressureArrheniusParameters(2, 1e12, -0.5, -800.0);
+    vector_fp troe{0.5, 100.0, 1500.0};
+    kin.setFalloffParameters(2, troe);
+    kin.setPlogParameters(3, 1, 2e3, 1.2, 5000.0);
+    const ChebyshevRate& cheb =
+        dynamic_cast<ChebyshevReaction&>(*kin_ref.reaction(4)).rate;
+    vector_fp coeffs = cheb.coeffs();
+    coeffs[0] += 0.5;
+    coeffs[5] -= 0.1;
+    kin.setChebyshevCoeffs(4, coeffs.data());
+
+    // The reference kinetics manager shares the Reaction objects, and is
+    // not affected
+    kin_ref.getFwdRateConstants(kf_ref.data());
+    for (size_t i = 0; i < nr; i++) {
+        EXPECT_DOUBLE_EQ(kf0[i], kf_ref[i]) << "i = " << i;
+    }
+
+    // Make the same changes by replacing the reactions
+    auto R0 = make_shared<ElementaryReaction>(
+        dynamic_cast<ElementaryReaction&>(*kin_ref.reaction(0)));
+    R0->rate = Arrhenius(A[0], b[0], E[0]);
+    kin_ref.modifyReaction(0, R0);
+    auto R1 = make_shared<ThreeBodyReaction>(
+        dynamic_cast<ThreeBodyReaction&>(*kin_ref.reaction(1)));
+    R1->rate = Arrhenius(A[1], b[1], E[1]);
+    kin_ref.modifyReaction(1, R1);
+    auto R2 = make_shared<FalloffReaction>(
+        dynamic_cast<FalloffReaction&>(*kin_ref.reaction(2)));
+    R2->high_rate = Arrhenius(A[2], b[2], E[2]);
+    R2->low_rate = Arrhenius(1e12, -0.5, -800.0);
+    R2->falloff = newFalloff(TROE_FALLOFF, troe);
+    kin_ref.modifyReaction(2, R2);
+    auto R3 = make_shared<PlogReaction>(
+        dynamic_cast<PlogReaction&>(*kin_ref.reaction(3)));
+    std::multimap<double, Arrhenius> plog;
+    auto plogRates = R3->rate.rates();
+    for (size_t j = 0; j < plogRates.size(); j++) {
+        plog.insert({plogRates[j].first, (j == 1) ?
+            Arrhenius(2e3, 1.2, 5000.0) : plogRates[j].second});
+    }
+    R3->rate = Plog(plog);
+    kin_ref.modifyReaction(3, R3);
+    auto R4 = make_shared<ChebyshevReaction>(
+        dynamic_cast<ChebyshevReaction&>(*kin_ref.reaction(4)));
+    Array2D C(cheb.nTemperature(), cheb.nPressure());
+    for (size_t t = 0; t < cheb.nTemperature(); t++) {
+        for (size_t q = 0; q < cheb.nPressure(); q++) {
+            C(t,q) = coeffs[cheb.nPressure()*t + q];
+        }
+    }
+    R4->rate = ChebyshevRate(cheb.Tmin(), cheb.Tmax(), cheb.Pmin(),
+                             cheb.Pmax(), C);
+    kin_ref.modifyReaction(4, R4);
+
+    vector_fp kr(nr), kr_ref(nr);
+    for (double P : {5*OneAtm, 0.3*OneAtm}) {
+        p.setState_TPX(1100, P, X);
+        p_ref.setState_TPX(1100, P, X);
+        kin.getFwdRateConstants(kf.data());
+        kin_ref.getFwdRateConstants(kf_ref.data());
+        kin.getRevRateConstants(kr.data());
+        kin_ref.getRevRateConstants(kr_ref.data());
+        for (size_t i = 0; i < nr; i++) {
+            EXPECT_DOUBLE_EQ(kf_ref[i], kf[i]) << "i = " << i;
+            EXPECT_DOUBLE_EQ(kr_ref[i], kr[i]) << "i = " << i;
+        }
+    }
+
+    EXPECT_THROW(kin.setArrheniusParameters(3, 1.0, 0.0, 0.0), CanteraError);
+    EXPECT_THROW(kin.setLowPressureArrheniusParameters(0, 1.0, 0.0, 0.0),
+                 CanteraError);
+    EXPECT_THROW(kin.setPlogParameters(4, 0, 1.0, 0.0, 0.0), CanteraError);
+    EXPECT_THROW(kin.setPlogParameters(3, 10, 1.0, 0.0, 0.0), CanteraError);
+    EXPECT_THROW(kin.setChebyshevCoeffs(3, coeffs.data()), CanteraError);
+    EXPECT_THROW(kin.setArrheniusParameters(nr, 1.0, 0.0, 0.0), CanteraError);
+}
+
 class InterfaceKineticsFromScratch : public testing::Test
 {
 public:
@@ -379,6 +648,139 @@ TEST_F(InterfaceKineticsFromScratch, add_sticking_reaction)
     check_rates(0);
 }
 
+TEST_F(InterfaceKineticsFromScratch, coverage_dependent_reaction)
+{
+    Composition reac = parseCompString("H(m):1 O(m):1");
+    Composition prod = parseCompString("OH(m):1 (m):1");
+    Arrhenius rate(5e21, 0, 12000);
+    auto R = make_shared<InterfaceReaction>(reac, prod, rate);
+    R->coverage_deps["O(m)"] = CoverageDependency(0.4, 3000, 0.5);
+    kin.addReaction(R);
+
+    gas.setState_TPX(1200, OneAtm, "H2:0.2 O2:0.5 H2O:0.1 N2:0.2");
+    surf.setState_TP(1200, OneAtm);
+    double k;
+    for (double theta : {0.2, 0.6}) {
+        surf.setCoveragesByName({{"H(m)", 0.1}, {"O(m)", theta},
+                                 {"(m)", 0.9 - theta}});
+        kin.getFwdRateConstants(&k);
+        double kExpected = 5e21 * pow(10, 0.4 * theta) * pow(theta, 0.5) *
+            exp(-(12000 + 3000 * theta) / 1200);
+        EXPECT_NEAR(kExpected, k, 1e-13 * kExpected);
+    }
+
+    // Removing the coverage dependence leaves only the Arrhenius part
+    auto R2 = make_shared<InterfaceReaction>(reac, prod, rate);
+    kin.modifyReaction(0, R2);
+    for (double theta : {0.6, 0.2}) {
+        surf.setCoveragesByName({{"H(m)", 0.1}, {"O(m)", theta},
+                                 {"(m)", 0.9 - theta}});
+        kin.getFwdRateConstants(&k);
+        EXPECT_NEAR(5e21 * exp(-10.0), k, 1e-13 * k);
+    }
+
+    // Adding it back
+    kin.modifyReaction(0, R);
+    kin.getFwdRateConstants(&k);
+    double kExpected = 5e21 * pow(10, 0.4 * 0.2) * pow(0.2, 0.5) *
+        exp(-(12000 + 3000 * 0.2) / 1200);
+    EXPECT_NEAR(kExpected, k, 1e-13 * kExpected);
+}
+
+TEST_F(InterfaceKineticsFromScratch, update_after_state_change)
+{
+    // Rate constants are only recomputed when the state they depend on has
+    // changed. Compare against a newly created kinetics object after changing
+    // each part of the state separately.
+    std::vector<ThermoPhase*> th = { &surf_ref, &gas_ref };
+    std::string X = "H2:0.2 O2:0.5 H2O:0.1 N2:0.2";
+    std::vector<std::string> Xs = {"H(m):0.1 O(m):0.2 OH(m):0.3 (m):0.4",
+                                   "H(m):0.3 O(m):0.1 OH(m):0.1 (m):0.5"};
+    double T[] = {1200, 1200, 1200, 1000};
+    double P[] = {5*OneAtm, 5*OneAtm, OneAtm, OneAtm};
+    size_t nr = kin_ref.nReactions();
+    vector_fp kr(nr), kr_new(nr), rop(nr), rop_new(nr);
+    for (size_t i = 0; i < 4; i++) {
+        gas_ref.setState_TPX(T[i], P[i], X);
+        surf_ref.setState_TP(T[i], P[i]);
+        surf_ref.setCoveragesByName(Xs[i % 2]);
+        kin_ref.getRevRateConstants(kr.data());
+        kin_ref.getNetRatesOfProgress(rop.data());
+
+        InterfaceKinetics kin_new;
+        importKinetics(surf_ref.xml(), th, &kin_new);
+        kin_new.getRevRateConstants(kr_new.data());
+        kin_new.getNetRatesOfProgress(rop_new.data());
+        for (size_t j = 0; j < nr; j++) {
+            EXPECT_DOUBLE_EQ(kr_new[j], kr[j]) << "i = " << i << ", j = " << j;
+            EXPECT_DOUBLE_EQ(rop_new[j], rop[j]) << "i = " << i << ", j = " << j;
+        }
+    }
+}
+
+TEST_F(InterfaceKineticsFromScratch, bulk_edit)
+{
+    std::string X = "H2:0.2 O2:0.5 H2O:0.1 N2:0.2";
+    std::string Xs = "H(m):0.1 O(m):0.2 OH(m):0.3 (m):0.4";
+    gas.setState_TPX(1200, 5*OneAtm, X);
+    gas_ref.setState_TPX(1200, 5*OneAtm, X);
+    surf.setState_TP(1200, 5*OneAtm);
+    surf_ref.setState_TP(1200, 5*OneAtm);
+    surf.setCoveragesByName(Xs);
+    surf_ref.setCoveragesByName(Xs);
+
+    size_t nr = kin_ref.nReactions();
+    kin.beginEdit();
+    for (size_t i = 0; i < nr; i++) {
+        kin.addReaction(kin_ref.reaction(i));
+    }
+    kin.removeReaction(0);
+    kin.commitEdit();
+    ASSERT_EQ(nr - 1, kin.nReactions());
+
+    vector_fp kf(nr), kf_ref(nr), rop(nr), rop_ref(nr);
+    kin_ref.setMultiplier(0, 0.0);
+    kin.getFwdRateConstants(kf.data());
+    kin_ref.getFwdRateConstants(kf_ref.data());
+    kin.getNetRatesOfProgress(rop.data());
+    kin_ref.getNetRatesOfProgress(rop_ref.data());
+    for (size_t i = 0; i < nr - 1; i++) {
+        EXPECT_DOUBLE_EQ(kf_ref[i+1], kf[i]) << "i = " << i;
+        EXPECT_DOUBLE_EQ(rop_ref[i+1], rop[i]) << "i = " << i;
+    }
+}
+
+TEST_F(InterfaceKineticsFromScratch, set_rate_parameters)
+{
+    size_t nr = kin_ref.nReactions();
+    for (size_t i = 0; i < nr; i++) {
+        kin.addReaction(kin_ref.reaction(i));
+    }
+    std::string X = "H2:0.2 O2:0.5 H2O:0.1 N2:0.2";
+    std::string Xs = "H(m):0.1 O(m):0.2 OH(m):0.3 (m):0.4";
+    gas.setState_TPX(1200, 5*OneAtm, X);
+    gas_ref.setState_TPX(1200, 5*OneAtm, X);
+    surf.setState_TP(1200, 5*OneAtm);
+    surf_ref.setState_TP(1200, 5*OneAtm);
+    surf.setCoveragesByName(Xs);
+    surf_ref.setCoveragesByName(Xs);
+
+    vector_fp kf(nr), kf_ref(nr), A(nr), b(nr), E(nr);
+    kin.getFwdRateConstants(kf.data());
+    kin.getArrheniusParameters(A.data(), b.data(), E.data());
+    for (size_t i = 0; i < nr; i++) {
+        A[i] *= 3.0;
+    }
+    kin.setArrheniusParameters(A.data(), b.data(), E.data());
+    kin.setArrheniusParameters(0, A[0], b[0] + 0.5, E[0]);
+    kin.getFwdRateConstants(kf.data());
+    kin_ref.getFwdRateConstants(kf_ref.data());
+    EXPECT_NEAR(3 * pow(1200, 0.5) * kf_ref[0], kf[0], 1e-12 * kf[0]);
+    for (size_t i = 1; i < nr; i++) {
+        EXPECT_NEAR(3 * kf_ref[i], kf[i], 1e-12 * kf[i]) << "i = " << i;
+    }
+}
+
 class KineticsAddSpecies : public testing::Test
 {
 public:
@@ -4,6 +4,9 @@
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/thermo/SurfPhase.h"
 #include "cantera/kinetics/GasKinetics.h"
+#include "cantera/kinetics/EdgeKinetics.h"
+#include "cantera/kinetics/ImplicitSurfChem.h"
+#include "cantera/kinetics/BatchSurfaceSolver.h"
 
 namespace Cantera
 {
@@ -212,4 +215,182 @@ TEST(InterfaceReaction, CoverageDependency) {
     EXPECT_NEAR(kf[1], 3.7e20 * exp(-(67.4e6-6e6*0.3)/(GasConstant*T)), 1e-14*kf[1]);
 }
 
+
+TEST(InterfaceReaction, ChargeTransferPotentialDerivatives) {
+    std::unique_ptr<ThermoPhase> metal(newPhase("../data/sofc-test.xml", "metal"));
+    std::unique_ptr<ThermoPhase> msurf(newPhase("../data/sofc-test.xml", "metal_surface"));
+    std::unique_ptr<ThermoPhase> osurf(newPhase("../data/sofc-test.xml", "oxide_surface"));
+    std::unique_ptr<ThermoPhase> tpb(newPhase("../data/sofc-test.xml", "tpb"));
+    std::vector<ThermoPhase*> phases { metal.get(), msurf.get(), osurf.get(), tpb.get() };
+    EdgeKinetics kin;
+    importKinetics(tpb->xml(), phases, &kin);
+    ASSERT_EQ((size_t) 2, kin.nReactions());
+
+    msurf->setMoleFractionsByName("(m):0.3 H(m):0.3 O(m):0.4");
+    osurf->setMoleFractionsByName("(ox):0.2 O''(ox):0.5 OH'(ox):0.3");
+    metal->setElectricPotential(0.2);
+    osurf->setElectricPotential(-0.1);
+
+    // The current into the metal is carried by the electrons
+    vector_fp wdot(kin.nTotalSpecies());
+    kin.getNetProductionRates(wdot.data());
+    size_t ke = kin.kineticsSpeciesIndex("electron");
+    double i0 = kin.currentDensity(0);
+    EXPECT_NEAR(-Faraday * wdot[ke], i0, 1e-12 * std::abs(i0));
+    EXPECT_NEAR(-i0, kin.currentDensity(2), 1e-12 * std::abs(i0));
+    EXPECT_EQ(0.0, kin.currentDensity(1));
+
+    // Compare the analytic derivatives with finite differences
+    double dphi = 1e-6;
+    vector_fp drop(2), ropp(2), ropm(2);
+    for (size_t n : {0, 2}) {
+        kin.getNetRatesOfProgress_ddPhi(n, drop.data());
+        double dI = kin.currentDensity_ddPhi(0, n);
+        double phi = phases[n]->electricPotential();
+        phases[n]->setElectricPotential(phi + dphi);
+        kin.getNetRatesOfProgress(ropp.data());
+        double ip = kin.currentDensity(0);
+        phases[n]->setElectricPotential(phi - dphi);
+        kin.getNetRatesOfProgress(ropm.data());
+        double im = kin.currentDensity(0);
+        phases[n]->setElectricPotential(phi);
+        for (size_t i = 0; i < 2; i++) {
+            double fd = (ropp[i] - ropm[i]) / (2 * dphi);
+            EXPECT_NEAR(fd, drop[i], 1e-6 * std::abs(fd));
+        }
+        EXPECT_NEAR((ip - im) / (2 * dphi), dI, 1e-6 * std::abs(dI));
+    }
+}
+
+
+TEST(InterfaceReaction, BatchPseudoSteadyState) {
+    IdealGasPhase gas("ptcombust.xml", "gas");
+    SurfPhase surf("ptcombust.xml", "Pt_surf");
+    std::vector<ThermoPhase*> phases { &gas, &surf };
+    shared_ptr<Kinetics> kin(newKineticsMgr(surf.xml(), phases));
+    InterfaceKinetics& ikin = dynamic_cast<InterfaceKinetics&>(*kin);
+    ImplicitSurfChem surfChem({&ikin});
+
+    size_t n = 7;
+    size_t nGas = gas.nSpecies();
+    size_t nSurf = surf.nSpecies();
+    size_t nTot = kin->nTotalSpecies();
+    vector_fp T(n), P(n, OneAtm), X(n * nGas), cov0(n * nSurf);
+    vector_fp cov(n * nSurf), sdot(n * nTot);
+    vector_fp covRef(nSurf), sdotRef(nTot);
+    for (size_t i = 0; i < n; i++) {
+        T[i] = 700 + 100 * i;
+        gas.setMoleFractionsByName("CH4:0.095, O2:0.21, AR:0.79");
+        gas.getMoleFractions(&X[i * nGas]);
+        X[i * nGas + gas.speciesIndex("CH4")] = 0.02 * (i + 1);
+        for (size_t k = 0; k < nSurf; k++) {
+            cov0[i * nSurf + k] = 0.1 / (nSurf - 1);
+        }
+        cov0[i * nSurf + surf.speciesIndex("PT(S)")] = 0.9;
+    }
+
+    BatchSurfaceSolver batch(ikin, 3);
+    ASSERT_EQ(batch.nThreads(), (size_t) 3);
+    cov = cov0;
+    batch.solve(n, &T[0], &P[0], &X[0], &cov[0], &sdot[0]);
+
+    for (size_t i = 0; i < n; i++) {
+        gas.setState_TPX(T[i], P[i], &X[i * nGas]);
+        surf.setState_TP(T[i], P[i]);
+        surf.setCoverages(&cov0[i * nSurf]);
+        surfChem.solvePseudoSteadyStateProblem(SFLUX_INITIALIZE);
+        surf.getCoverages(&covRef[0]);
+        kin->getNetProductionRates(&sdotRef[0]);
+        for (size_t k = 0; k < nSurf; k++) {
+            EXPECT_NEAR(cov[i * nSurf + k], covRef[k], 1e-6);
+        }
+        for (size_t k = 0; k < nGas; k++) {
+            EXPECT_NEAR(sdot[i * nTot + k], sdotRef[k],
+                        1e-4 * std::abs(sdotRef[k]) + 1e-12);
+        }
+    }
+}
+
+TEST(InterfaceReaction, BatchSolveModifiedRate) {
+    // The workers are created from the input file, so they can not be used if
+    // a rate has been modified in memory
+    std::unique_ptr<ThermoPhase> gas(newPhase("ptcombust.xml", "gas"));
+    std::unique_ptr<ThermoPhase> surf(newPhase("ptcombust.xml", "Pt_surf"));
+    std::vector<ThermoPhase*> p { gas.get(), surf.get() };
+    std::unique_ptr<Kinetics> kin(newKineticsMgr(surf->xml(), p));
+    InterfaceKinetics& ikin = dynamic_cast<InterfaceKinetics&>(*kin);
+    gas->setState_TPX(900, OneAtm, "CH4:0.095, O2:0.21, AR:0.79");
+    surf->setState_TP(900, OneAtm);
+    auto R = std::make_shared<InterfaceReaction>(
+        dynamic_cast<InterfaceReaction&>(*kin->reaction(0)));
+    R->rate = Arrhenius(2 * R->rate.preExponentialFactor(),
+                        R->rate.temperatureExponent(),
+                        R->rate.activationEnergy_R());
+    kin->modifyReaction(0, R);
+    EXPECT_THROW(BatchSurfaceSolver(ikin, 2), CanteraError);
+}
+
+TEST(InterfaceReaction, ParallelJacobian) {
+    // Identical surface problems, solved with the Jacobian evaluated by one
+    // and by three threads
+    std::vector<std::unique_ptr<ThermoPhase>> phases;
+    std::vector<std::unique_ptr<Kinetics>> kin;
+    std::vector<std::unique_ptr<ImplicitSurfChem>> surfChem;
+    for (size_t i = 0; i < 2; i++) {
+        phases.emplace_back(newPhase("ptcombust.xml", "gas"));
+        phases.emplace_back(newPhase("ptcombust.xml", "Pt_surf"));
+        std::vector<ThermoPhase*> p { phases[2*i].get(), phases[2*i+1].get() };
+        kin.emplace_back(newKineticsMgr(p[1]->xml(), p));
+        InterfaceKinetics* ikin = dynamic_cast<InterfaceKinetics*>(kin[i].get());
+        surfChem.emplace_back(new ImplicitSurfChem({ikin}));
+        p[0]->setState_TPX(900, OneAtm, "CH4:0.095, O2:0.21, AR:0.79");
+        p[1]->setState_TP(900, OneAtm);
+    }
+    surfChem[1]->setJacobianThreads(3);
+
+    size_t nSurf = phases[1]->nSpecies();
+    vector_fp cov0(nSurf, 0.1 / (nSurf - 1)), cov1(nSurf), cov2(nSurf);
+    cov0[phases[1]->speciesIndex("PT(S)")] = 0.9;
+    SurfPhase& surf1 = dynamic_cast<SurfPhase&>(*phases[1]);
+    SurfPhase& surf2 = dynamic_cast<SurfPhase&>(*phases[3]);
+    for (int ifunc : {SFLUX_INITIALIZE, SFLUX_RESIDUAL}) {
+        surf1.setCoverages(cov0.data());
+        surf2.setCoverages(cov0.data());
+        surfChem[0]->solvePseudoSteadyStateProblem(ifunc);
+        surfChem[1]->solvePseudoSteadyStateProblem(ifunc);
+        surf1.getCoverages(cov1.data());
+        surf2.getCoverages(cov2.data());
+        for (size_t k = 0; k < nSurf; k++) {
+            EXPECT_EQ(cov1[k], cov2[k]);
+        }
+        cov0[phases[1]->speciesIndex("O(S)")] += 0.05;
+    }
+}
+
+TEST(InterfaceReaction, ParallelJacobianModifiedRate) {
+    // The copies used by the additional threads are created from the input
+    // file, so they can not be used if a rate has been modified in memory
+    std::unique_ptr<ThermoPhase> gas(newPhase("ptcombust.xml", "gas"));
+    std::unique_ptr<ThermoPhase> surf(newPhase("ptcombust.xml", "Pt_surf"));
+    std::vector<ThermoPhase*> p { gas.get(), surf.get() };
+    std::unique_ptr<Kinetics> kin(newKineticsMgr(surf->xml(), p));
+    InterfaceKinetics* ikin = dynamic_cast<InterfaceKinetics*>(kin.get());
+    gas->setState_TPX(900, OneAtm, "CH4:0.095, O2:0.21, AR:0.79");
+    surf->setState_TP(900, OneAtm);
+    auto R = std::make_shared<InterfaceReaction>(
+        dynamic_cast<InterfaceReaction&>(*kin->reaction(0)));
+    R->rate = Arrhenius(2 * R->rate.preExponentialFactor(),
+                        R->rate.temperatureExponent(),
+                        R->rate.activationEnergy_R());
+    kin->modifyReaction(0, R);
+
+    ImplicitSurfChem surfChem({ikin});
+    surfChem.setJacobianThreads(3);
+    EXPECT_THROW(surfChem.solvePseudoSteadyStateProblem(), CanteraError);
+
+    // With a single thread, the modified rate is used
+    surfChem.setJacobianThreads(1);
+    surfChem.solvePseudoSteadyStateProblem();
+}
+
 }
@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/DebyeHuckel.h"
+
+namespace Cantera
+{
+
+class DebyeHuckel_Test : public testing::Test
+{
+public:
+    DebyeHuckel_Test()
+        : phase("../data/DH_NaCl_bdotak.xml")
+        , fresh("../data/DH_NaCl_bdotak.xml")
+        , ac(phase.nSpecies())
+        , acFresh(phase.nSpecies())
+    {
+        phase.getMolalityActivityCoefficients(ac.data());
+    }
+
+    // Check that the activity coefficients of 'phase' have changed, and
+    // match those of a phase where the same parameter was set before any
+    // activity coefficients were evaluated.
+    void check() {
+        vector_fp ac0 = ac;
+        phase.getMolalityActivityCoefficients(ac.data());
+        fresh.getMolalityActivityCoefficients(acFresh.data());
+        EXPECT_NE(ac0[1], ac[1]);
+        for (size_t k = 0; k < phase.nSpecies(); k++) {
+            EXPECT_DOUBLE_EQ(acFresh[k], ac[k]) << k;
+        }
+    }
+
+    DebyeHuckel phase, fresh;
+    vector_fp ac, acFresh;
+};
+
+TEST_F(DebyeHuckel_Test, set_A_Debye)
+{
+    phase.setA_Debye(1.0);
+    fresh.setA_Debye(1.0);
+    check();
+}
+
+TEST_F(DebyeHuckel_Test, set_B_Debye)
+{
+    phase.setB_Debye(3.0e9);
+    fresh.setB_Debye(3.0e9);
+    check();
+}
+
+TEST_F(DebyeHuckel_Test, set_B_dot)
+{
+    phase.setB_dot("Na+", 0.05);
+    fresh.setB_dot("Na+", 0.05);
+    check();
+    EXPECT_THROW(phase.setB_dot("Xe", 0.05), CanteraError);
+}
+
+TEST_F(DebyeHuckel_Test, set_ionic_radius)
+{
+    phase.setIonicRadius("Na+", 5e-10);
+    fresh.setIonicRadius("Na+", 5e-10);
+    check();
+    EXPECT_DOUBLE_EQ(5e-10, phase.AionicRadius(1));
+}
+
+TEST_F(DebyeHuckel_Test, copy_state)
+{
+    // The pressure is an independent variable, and the density depends on it
+    phase.setState_TP(350, 5e6);
+    phase.setMolalitiesByName("Na+:3.0 Cl-:3.0");
+    fresh.copyStateFrom(phase);
+    EXPECT_DOUBLE_EQ(350, fresh.temperature());
+    EXPECT_DOUBLE_EQ(5e6, fresh.pressure());
+    EXPECT_DOUBLE_EQ(phase.density(), fresh.density());
+    phase.getMolalityActivityCoefficients(ac.data());
+    fresh.getMolalityActivityCoefficients(acFresh.data());
+    for (size_t k = 0; k < phase.nSpecies(); k++) {
+        EXPECT_DOUBLE_EQ(ac[k], acFresh[k]) << k;
+    }
+    EXPECT_DOUBLE_EQ(phase.gibbs_mole(), fresh.gibbs_mole());
+}
+
+TEST(DebyeHuckel, water_A_Debye_state_change)
+{
+    // A_Debye depends on the temperature and pressure, so the cached activity
+    // coefficients must be recomputed when either changes
+    DebyeHuckel phase("../data/DH_NaCl_water.xml");
+    size_t nsp = phase.nSpecies();
+    vector_fp ac0(nsp), ac(nsp), acRef(nsp);
+    phase.getMolalityActivityCoefficients(ac0.data());
+    double A0 = phase.A_Debye_TP();
+
+    std::vector<std::pair<double, double>> states{{350, OneAtm},
+                                                  {350, 100 * OneAtm}};
+    for (const auto& TP : states) {
+        phase.setState_TP(TP.first, TP.second);
+        phase.getMolalityActivityCoefficients(ac.data());
+        EXPECT_NE(A0, phase.A_Debye_TP());
+        EXPECT_NE(ac0[1], ac[1]);
+
+        // Compare with a phase which has not cached any values
+        DebyeHuckel ref("../data/DH_NaCl_water.xml");
+        ref.setState_TP(TP.first, TP.second);
+        ref.getMolalityActivityCoefficients(acRef.data());
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_DOUBLE_EQ(acRef[k], ac[k]) << k;
+        }
+        A0 = phase.A_Debye_TP();
+        ac0 = ac;
+    }
+}
+
+}
@@ -0,0 +1,57 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/VPStandardStateTP.h"
+#include "cantera/thermo/PDSS.h"
+
+namespace Cantera
+{
+
+class PDSS_HKFT_Test : public testing::Test
+{
+public:
+    PDSS_HKFT_Test() {
+        phase.reset(dynamic_cast<VPStandardStateTP*>(
+            newPhase("../data/HMW_NaCl_pdss.xml")));
+        fresh.reset(dynamic_cast<VPStandardStateTP*>(
+            newPhase("../data/HMW_NaCl_pdss.xml")));
+    }
+
+    std::unique_ptr<VPStandardStateTP> phase, fresh;
+};
+
+TEST_F(PDSS_HKFT_Test, shared_solvent_cache)
+{
+    // Species 1 and 2 (Na+ and Cl-) use the HKFT standard state and share
+    // the solvent functions evaluated for the state of the phase
+    phase->setState_TP(350, 5e5);
+    vector_fp mu(phase->nSpecies());
+    phase->getStandardChemPotentials(mu.data());
+
+    // The water standard state is left at the state of the last evaluation,
+    // also when the solvent functions are taken from the cache
+    PDSS* water = phase->providePDSS(0);
+    PDSS* cl = phase->providePDSS(2);
+    water->setState_TP(400, 6e5);
+    cl->setState_TP(350, 5e5);
+    double h = cl->enthalpy_mole();
+    double cp = cl->cp_mole();
+    EXPECT_DOUBLE_EQ(350, water->temperature());
+    EXPECT_NEAR(5e5, water->pressure(), 1e-3);
+
+    // Same values from a phase where the solvent functions at this state
+    // have not been evaluated before
+    PDSS* cl2 = fresh->providePDSS(2);
+    cl2->setState_TP(350, 5e5);
+    EXPECT_DOUBLE_EQ(h, cl2->enthalpy_mole());
+    EXPECT_DOUBLE_EQ(cp, cl2->cp_mole());
+    EXPECT_DOUBLE_EQ(fresh->providePDSS(0)->density(), water->density());
+
+    fresh->setState_TP(350, 5e5);
+    vector_fp mu2(fresh->nSpecies());
+    fresh->getStandardChemPotentials(mu2.data());
+    for (size_t k = 0; k < phase->nSpecies(); k++) {
+        EXPECT_DOUBLE_EQ(mu2[k], mu[k]) << k;
+    }
+}
+
+}
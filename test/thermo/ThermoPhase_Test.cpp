@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
+#include "cantera/base/ctml.h"
 #include <vector>
 
 namespace Cantera
@@ -98,4 +99,53 @@ TEST_F(TestThermoMethods, setState_nan)
     EXPECT_THROW(thermo->setState_TR(555, nan), CanteraError);
 }
 
+TEST_F(TestThermoMethods, saveRestoreSnapshot)
+{
+    thermo->setState_TPX(500, 2e5, "O2:0.2, H2:0.3, AR:0.5");
+    StateSnapshot state;
+    thermo->saveState(state);
+    int stateNum = thermo->stateMFNumber();
+    double h = thermo->enthalpy_mass();
+    ASSERT_EQ(state.size(), thermo->nSpecies() + 2);
+    EXPECT_DOUBLE_EQ(state.temperature(), 500);
+
+    // Restoring the unmodified state is a no-op
+    thermo->restoreState(state);
+    EXPECT_EQ(thermo->stateMFNumber(), stateNum);
+
+    thermo->setState_TPX(900, 1e5, "H2O:0.7, AR:0.3");
+    EXPECT_NE(thermo->stateMFNumber(), stateNum);
+    thermo->restoreState(state);
+    EXPECT_EQ(thermo->stateMFNumber(), stateNum);
+    EXPECT_DOUBLE_EQ(thermo->temperature(), 500);
+    EXPECT_DOUBLE_EQ(thermo->pressure(), 2e5);
+    EXPECT_DOUBLE_EQ(thermo->moleFraction("H2"), 0.3);
+    EXPECT_DOUBLE_EQ(thermo->enthalpy_mass(), h);
+
+    // A new composition must not reuse a previously assigned state number
+    thermo->setMoleFractionsByName("O2:1.0");
+    EXPECT_GT(thermo->stateMFNumber(), stateNum + 1);
+
+    // Restoring into a different phase uses the full update
+    std::unique_ptr<ThermoPhase> other(newPhase("h2o2.xml"));
+    other->restoreState(state);
+    EXPECT_DOUBLE_EQ(other->temperature(), 500);
+    EXPECT_DOUBLE_EQ(other->pressure(), 2e5);
+}
+
+TEST(PhaseCopy, xml_copy_on_write)
+{
+    Phase p1;
+    p1.setXMLdata(*findXMLPhase(get_XML_File("h2o2.xml"), "ohmech"));
+    Phase p2(p1);
+    // Read-only access does not copy the shared tree
+    EXPECT_EQ(&p1.xml(), &p2.xml());
+    p2.modifiableXml().addChild("extra", "1");
+    EXPECT_TRUE(p2.xml().hasChild("extra"));
+    EXPECT_FALSE(p1.xml().hasChild("extra"));
+    EXPECT_EQ(p1.xml().id(), p2.xml().id());
+    EXPECT_TRUE(p2.xml().hasChild("thermo"));
+    EXPECT_NE(&p1.xml().root(), &p2.xml().root());
+}
+
 }
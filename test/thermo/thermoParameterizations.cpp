@@ -49,6 +49,27 @@ TEST_F(SpeciesThermoInterpTypeTest, install_const_cp)
     EXPECT_DOUBLE_EQ(p2.cp_mass(), p.cp_mass());
 }
 
+TEST_F(SpeciesThermoInterpTypeTest, restore_snapshot_after_add)
+{
+    auto sO2 = make_shared<Species>("O2", parseCompString("O:2"));
+    auto sH2 = make_shared<Species>("H2", parseCompString("H:2"));
+    auto sH2O = make_shared<Species>("H2O", parseCompString("H:2 O:1"));
+    sO2->thermo.reset(new ConstCpPoly(200, 5000, 101325, c_o2));
+    sH2->thermo.reset(new ConstCpPoly(200, 5000, 101325, c_h2));
+    sH2O->thermo.reset(new ConstCpPoly(200, 5000, 101325, c_h2o));
+    p.addSpecies(sO2);
+    p.addSpecies(sH2);
+    p.initThermo();
+    p.setState_TPX(400, 101325, "H2:0.4, O2:0.6");
+    StateSnapshot state;
+    p.saveState(state);
+
+    // The snapshot no longer matches the species of the phase
+    p.addSpecies(sH2O);
+    p.initThermo();
+    EXPECT_THROW(p.restoreState(state), CanteraError);
+}
+
 TEST_F(SpeciesThermoInterpTypeTest, DISABLED_install_bad_pref)
 {
     // Currently broken because MultiSpeciesThermo does not enforce reference
@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+
+#include "cantera/transport/TransportFactory.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+using namespace Cantera;
+
+class HighPressureTransportTest : public testing::Test
+{
+public:
+    HighPressureTransportTest()
+        : gas(newPhase("../data/co2_RK_example.xml", "carbondioxide"))
+    {
+        gas->setState_TPX(400, 100*OneBar, "CO2:0.7, H2O:0.1, N2:0.2");
+        tran.reset(newDefaultTransportMgr(gas.get()));
+    }
+
+    std::unique_ptr<ThermoPhase> gas;
+    std::unique_ptr<Transport> tran;
+};
+
+TEST_F(HighPressureTransportTest, state_unchanged)
+{
+    int stateNum = gas->stateMFNumber();
+    double X0 = gas->moleFraction(0);
+    vector_fp d(9);
+    EXPECT_EQ("HighPressureGas", tran->transportType());
+    EXPECT_GT(tran->viscosity(), 0.0);
+    EXPECT_GT(tran->thermalConductivity(), 0.0);
+    tran->getBinaryDiffCoeffs(3, d.data());
+    EXPECT_EQ(stateNum, gas->stateMFNumber());
+    EXPECT_EQ(X0, gas->moleFraction(0));
+}
+
+TEST_F(HighPressureTransportTest, independent_of_initial_state)
+{
+    // The critical constants of the species are evaluated when the transport
+    // object is created, and do not depend on the state at that time
+    gas->setState_TPX(500, 150*OneBar, "CO2:0.2, H2O:0.3, N2:0.5");
+    std::unique_ptr<Transport> tran2(newDefaultTransportMgr(gas.get()));
+    EXPECT_DOUBLE_EQ(tran2->viscosity(), tran->viscosity());
+    EXPECT_DOUBLE_EQ(tran2->thermalConductivity(),
+                     tran->thermalConductivity());
+
+    vector_fp d1(9), d2(9);
+    tran->getBinaryDiffCoeffs(3, d1.data());
+    tran2->getBinaryDiffCoeffs(3, d2.data());
+    for (size_t i = 0; i < 9; i++) {
+        EXPECT_DOUBLE_EQ(d2[i], d1[i]);
+    }
+}